@@ -17,7 +17,7 @@ SQLRETURN GetColumnUtf16(SQLHSTMT stmt,
                          SQLUSMALLINT column,
                          Utf16StringType* result,
                          SQLLEN* indicator,
-                         SqlDataBinderCallback const& /*cb*/) noexcept
+                         SqlDataBinderCallback const& cb) noexcept
 {
     using CharType = char16_t;
     constexpr auto CType = SQL_C_WCHAR;
@@ -25,7 +25,7 @@ SQLRETURN GetColumnUtf16(SQLHSTMT stmt,
     if constexpr (requires { Utf16StringType::Capacity; })
         result->resize(Utf16StringType::Capacity);
     else
-        result->resize(255);
+        result->resize(StringColumnBufferSize(cb, column, 254) + 1);
 
     *indicator = 0;
 
@@ -71,6 +71,22 @@ SQLRETURN GetColumnUtf16(SQLHSTMT stmt,
     return sqlResult;
 }
 
+// Restores the bound buffer of an output string column, which post-processing the previous row
+// has resized to the length of its data, and rebinds it in case the string reallocated its storage.
+template <typename StringTraits, typename StringType, SQLSMALLINT CType>
+void RestoreOutputColumnStringBuffer(SqlOutputColumnFixup& fixup) noexcept
+{
+    auto* const result = static_cast<StringType*>(fixup.result);
+    if (fixup.bufferSize > 0)
+        StringTraits::Resize(result, fixup.bufferSize);
+
+    if (auto* const data = (SQLPOINTER) StringTraits::Data(result); data != fixup.buffer)
+    {
+        fixup.buffer = data;
+        SQLBindCol(fixup.stmt, fixup.column, CType, fixup.buffer, fixup.bufferSize, fixup.indicator);
+    }
+}
+
 } // namespace detail
 
 // SqlDataBinder<> specialization for ANSI character strings
@@ -109,19 +125,33 @@ struct LIGHTWEIGHT_API SqlDataBinder<AnsiStringType>
     {
         if constexpr (requires { AnsiStringType::Capacity; })
             StringTraits::Resize(result, AnsiStringType::Capacity);
+        else if (StringTraits::Size(result) == 0)
+        {
+            // Presize the bound buffer, such that values do not need to be retrieved via SQLGetData() after all.
+            if (auto const columnSize = detail::StringColumnBufferSize(cb, column, 0); columnSize > 0)
+                StringTraits::Reserve(result, columnSize + 1);
+        }
 
-        if constexpr (requires { StringTraits::PostProcessOutputColumn(result, *indicator); })
-            cb.PlanPostProcessOutputColumn(
-                [indicator, result]() { StringTraits::PostProcessOutputColumn(result, *indicator); });
-        else
-            cb.PlanPostProcessOutputColumn(
-                [stmt, column, indicator, result]() { PostProcessOutputColumn(stmt, column, result, indicator); });
-        return SQLBindCol(stmt,
-                          column,
-                          SQL_C_CHAR,
-                          (SQLPOINTER) StringTraits::Data(result),
-                          (SQLLEN) StringTraits::Size(result),
-                          indicator);
+        auto fixup = SqlOutputColumnFixup {
+            .postProcess =
+                [](SqlOutputColumnFixup& fixup) {
+                    auto* const result = static_cast<AnsiStringType*>(fixup.result);
+                    if constexpr (requires { StringTraits::PostProcessOutputColumn(result, *fixup.indicator); })
+                        StringTraits::PostProcessOutputColumn(result, *fixup.indicator);
+                    else
+                        PostProcessOutputColumn(fixup.stmt, fixup.column, result, fixup.indicator);
+                },
+            .prepareFetch = &detail::RestoreOutputColumnStringBuffer<StringTraits, AnsiStringType, SQL_C_CHAR>,
+            .stmt = stmt,
+            .column = column,
+            .result = result,
+            .indicator = indicator,
+            .buffer = (SQLPOINTER) StringTraits::Data(result),
+            .bufferSize = (SQLLEN) StringTraits::Size(result),
+        };
+        auto const sqlReturn = SQLBindCol(stmt, column, SQL_C_CHAR, fixup.buffer, fixup.bufferSize, indicator);
+        cb.PlanPostProcessOutputColumn(std::move(fixup));
+        return sqlReturn;
     }
 
     static void PostProcessOutputColumn(SQLHSTMT stmt, SQLUSMALLINT column, AnsiStringType* result, SQLLEN* indicator)
@@ -163,7 +193,7 @@ struct LIGHTWEIGHT_API SqlDataBinder<AnsiStringType>
                                SQLUSMALLINT column,
                                AnsiStringType* result,
                                SQLLEN* indicator,
-                               SqlDataBinderCallback const& /*cb*/) noexcept
+                               SqlDataBinderCallback const& cb) noexcept
     {
         if constexpr (requires { AnsiStringType::Capacity; })
         {
@@ -183,7 +213,7 @@ struct LIGHTWEIGHT_API SqlDataBinder<AnsiStringType>
         }
         else
         {
-            StringTraits::Reserve(result, 15);
+            StringTraits::Reserve(result, detail::StringColumnBufferSize(cb, column, 14) + 1);
             size_t writeIndex = 0;
             *indicator = 0;
             while (true)
@@ -302,36 +332,45 @@ struct LIGHTWEIGHT_API SqlDataBinder<Utf16StringType>
         if constexpr (requires { Utf16StringType::Capacity; })
             StringTraits::Resize(result, Utf16StringType::Capacity);
         else
-            StringTraits::Reserve(result, 255);
-
-        if constexpr (requires { StringTraits::PostProcessOutputColumn(result, *indicator); })
-        {
-            cb.PlanPostProcessOutputColumn(
-                [indicator, result]() { StringTraits::PostProcessOutputColumn(result, *indicator); });
-        }
-        else
-        {
-            cb.PlanPostProcessOutputColumn([indicator, result]() {
-                // Now resize the string to the actual length of the data
-                // NB: If the indicator is greater than the buffer size, we have a truncation.
-                if (*indicator != SQL_NULL_DATA)
-                {
-                    auto const bufferSize = StringTraits::Size(result);
-                    auto const len = std::cmp_greater_equal(*indicator, bufferSize) || *indicator == SQL_NO_TOTAL
-                                         ? bufferSize - 1
-                                         : *indicator;
-                    StringTraits::Resize(result, len / sizeof(decltype(StringTraits::Data(result)[0])));
-                }
-                else
-                    StringTraits::Resize(result, 0);
-            });
-        }
-        return SQLBindCol(stmt,
-                          column,
-                          CType,
-                          (SQLPOINTER) StringTraits::Data(result),
-                          (SQLLEN) StringTraits::Size(result),
-                          indicator);
+            StringTraits::Reserve(result, detail::StringColumnBufferSize(cb, column, 254) + 1);
+
+        auto fixup = SqlOutputColumnFixup {
+            .postProcess =
+                [](SqlOutputColumnFixup& fixup) {
+                    auto* const result = static_cast<Utf16StringType*>(fixup.result);
+                    auto const* const indicator = fixup.indicator;
+                    if constexpr (requires { StringTraits::PostProcessOutputColumn(result, *indicator); })
+                    {
+                        StringTraits::PostProcessOutputColumn(result, *indicator);
+                    }
+                    else
+                    {
+                        // Now resize the string to the actual length of the data
+                        // NB: If the indicator is greater than the buffer size, we have a truncation.
+                        if (*indicator != SQL_NULL_DATA)
+                        {
+                            auto const bufferSize = StringTraits::Size(result);
+                            auto const len =
+                                std::cmp_greater_equal(*indicator, bufferSize) || *indicator == SQL_NO_TOTAL
+                                    ? bufferSize - 1
+                                    : *indicator;
+                            StringTraits::Resize(result, len / sizeof(decltype(StringTraits::Data(result)[0])));
+                        }
+                        else
+                            StringTraits::Resize(result, 0);
+                    }
+                },
+            .prepareFetch = &detail::RestoreOutputColumnStringBuffer<StringTraits, Utf16StringType, CType>,
+            .stmt = stmt,
+            .column = column,
+            .result = result,
+            .indicator = indicator,
+            .buffer = (SQLPOINTER) StringTraits::Data(result),
+            .bufferSize = (SQLLEN) StringTraits::Size(result),
+        };
+        auto const sqlReturn = SQLBindCol(stmt, column, CType, fixup.buffer, fixup.bufferSize, indicator);
+        cb.PlanPostProcessOutputColumn(std::move(fixup));
+        return sqlReturn;
     }
 
     static SQLRETURN GetColumn(SQLHSTMT stmt,
@@ -419,35 +458,56 @@ struct LIGHTWEIGHT_API SqlDataBinder<Utf32StringType>
         else
             u16String->resize(255);
 
-        cb.PlanPostProcessOutputColumn([stmt, column, result, indicator, u16String = u16String]() {
-            switch (*indicator)
-            {
-                case SQL_NULL_DATA:
-                    u16String->clear();
-                    break;
-                case SQL_NO_TOTAL:
-                    break;
-                default:
-                    // NOLINTNEXTLINE(readability-use-std-min-max)
-                    if (*indicator > static_cast<SQLLEN>(u16String->size() * sizeof(char16_t)))
+        auto fixup = SqlOutputColumnFixup {
+            .postProcess =
+                [](SqlOutputColumnFixup& fixup) {
+                    auto& u16String = *std::static_pointer_cast<std::u16string>(fixup.state);
+                    auto* const indicator = fixup.indicator;
+                    switch (*indicator)
                     {
-                        // We have a truncation and the server knows how much data is left.
-                        *indicator = static_cast<SQLLEN>(u16String->size() * sizeof(char16_t));
-                        // TODO: call SQLGetData() to get the rest of the data
+                        case SQL_NULL_DATA:
+                            u16String.clear();
+                            break;
+                        case SQL_NO_TOTAL:
+                            break;
+                        default:
+                            // NOLINTNEXTLINE(readability-use-std-min-max)
+                            if (*indicator > static_cast<SQLLEN>(u16String.size() * sizeof(char16_t)))
+                            {
+                                // We have a truncation and the server knows how much data is left.
+                                *indicator = static_cast<SQLLEN>(u16String.size() * sizeof(char16_t));
+                                // TODO: call SQLGetData() to get the rest of the data
+                            }
+                            u16String.resize(*indicator / sizeof(char16_t));
+                            break;
                     }
-                    u16String->resize(*indicator / sizeof(char16_t));
-                    break;
-            }
-            auto const u32String = ToUtf32(*u16String);
-            *result = { (CharType const*) u32String.data(), (CharType const*) u32String.data() + u32String.size() };
-        });
-
-        return SQLBindCol(stmt,
-                          column,
-                          CType,
-                          static_cast<SQLPOINTER>(u16String->data()),
-                          static_cast<SQLLEN>(u16String->size() * sizeof(char16_t)),
-                          indicator);
+                    auto const u32String = ToUtf32(u16String);
+                    *static_cast<Utf32StringType*>(fixup.result) = {
+                        (CharType const*) u32String.data(), (CharType const*) u32String.data() + u32String.size()
+                    };
+                },
+            .prepareFetch =
+                [](SqlOutputColumnFixup& fixup) {
+                    // Restore the intermediate buffer, which has been resized to the previous row's length.
+                    auto& u16String = *std::static_pointer_cast<std::u16string>(fixup.state);
+                    u16String.resize(static_cast<size_t>(fixup.bufferSize) / sizeof(char16_t));
+                    if (u16String.data() != fixup.buffer)
+                    {
+                        fixup.buffer = u16String.data();
+                        SQLBindCol(fixup.stmt, fixup.column, CType, fixup.buffer, fixup.bufferSize, fixup.indicator);
+                    }
+                },
+            .stmt = stmt,
+            .column = column,
+            .result = result,
+            .indicator = indicator,
+            .buffer = static_cast<SQLPOINTER>(u16String->data()),
+            .bufferSize = static_cast<SQLLEN>(u16String->size() * sizeof(char16_t)),
+            .state = u16String,
+        };
+        auto const sqlReturn = SQLBindCol(stmt, column, CType, fixup.buffer, fixup.bufferSize, indicator);
+        cb.PlanPostProcessOutputColumn(std::move(fixup));
+        return sqlReturn;
     }
 
     static SQLRETURN GetColumn(SQLHSTMT stmt,
@@ -11,11 +11,49 @@
 
 #include <concepts>
 #include <functional>
+#include <memory>
+#include <string>
 
 #include <sql.h>
 #include <sqlext.h>
 #include <sqltypes.h>
 
+// Non-allocating fixup of a bound output column, e.g. to trim a string to the length of the fetched data.
+//
+// SqlStatement keeps the fixups of all bound columns in a table and applies them to every fetched row,
+// until the column is bound again or unbound.
+struct SqlOutputColumnFixup
+{
+    using Function = void (*)(SqlOutputColumnFixup& fixup);
+
+    // Applied after each fetched row, in the order the fixups of a column have been planned.
+    Function postProcess = nullptr;
+
+    // Applied before each fetch in reverse order (may be nullptr), to restore the bound buffer
+    // in case post-processing of the previous row changed it, e.g. by resizing a string.
+    Function prepareFetch = nullptr;
+
+    SQLHSTMT stmt {};
+    SQLUSMALLINT column {};
+    void* result {};      // The bound output value.
+    SQLLEN* indicator {}; // The bound indicator.
+    SQLPOINTER buffer {}; // The buffer passed to SQLBindCol(), if it is not the output value itself.
+    SQLLEN bufferSize {}; // The size of the buffer passed to SQLBindCol().
+
+    // State owned by the fixup, such as an intermediate conversion buffer.
+    std::shared_ptr<void> state {};
+};
+
+// Describes a column of a result set, as reported by the driver via SQLDescribeCol().
+struct SqlColumnMetadata
+{
+    std::string name;             // The name of the column.
+    SQLSMALLINT sqlType {};       // The (concise) SQL data type, e.g. SQL_VARCHAR or SQL_TYPE_DATE.
+    SQLULEN size {};              // The column size, e.g. the maximum number of characters of a string column.
+    SQLSMALLINT decimalDigits {}; // The number of decimal digits of numeric or fractional seconds of time columns.
+    bool nullable = true;         // Whether the column may contain NULL values (or it is unknown whether it may).
+};
+
 // Callback interface for SqlDataBinder to allow post-processing of output columns.
 //
 // This is needed because the SQLBindCol() function does not allow to specify a callback function to be called
@@ -33,10 +71,34 @@ class LIGHTWEIGHT_API SqlDataBinderCallback
     virtual ~SqlDataBinderCallback() = default;
 
     virtual void PlanPostExecuteCallback(std::function<void()>&&) = 0;
-    virtual void PlanPostProcessOutputColumn(std::function<void()>&&) = 0;
+    virtual void PlanPostProcessOutputColumn(SqlOutputColumnFixup&&) = 0;
     [[nodiscard]] virtual SqlServerType ServerType() const noexcept = 0;
+
+    // Retrieves the metadata of the given result column (starting at 1), or nullptr if it is not available.
+    [[nodiscard]] virtual SqlColumnMetadata const* DescribeColumn(SQLUSMALLINT /*column*/) const noexcept
+    {
+        return nullptr;
+    }
 };
 
+namespace detail
+{
+
+// Retrieves the number of characters to initially reserve for retrieving the value of a string column,
+// being the column size, unless it is unknown or unlimited (e.g. TEXT), in which case the fallback is used.
+inline std::size_t StringColumnBufferSize(SqlDataBinderCallback const& cb,
+                                          SQLUSMALLINT column,
+                                          std::size_t fallback) noexcept
+{
+    constexpr auto MaxColumnSize = SQLULEN { 4096 };
+    if (auto const* metadata = cb.DescribeColumn(column); metadata && metadata->size > 0
+                                                          && metadata->size <= MaxColumnSize)
+        return static_cast<std::size_t>(metadata->size);
+    return fallback;
+}
+
+} // namespace detail
+
 template <typename>
 struct SqlDataBinder;
 
@@ -112,6 +174,49 @@ concept SqlInputParameterBinder =
         { SqlDataBinder<T>::InputParameter(hStmt, column, value, cb) } -> std::same_as<SQLRETURN>;
     };
 
+namespace detail
+{
+
+// The elements of the arrays bound by SqlDataBinder<T>::InputParameterArray(), which are the values themselves,
+// unless their layout differs from the C type they are bound with, in which case the binder declares
+// an ArrayElementType along with a ToArrayElement() conversion.
+template <typename T>
+struct SqlParameterArrayElement
+{
+    using type = T;
+
+    static LIGHTWEIGHT_FORCE_INLINE constexpr T const& From(T const& value) noexcept
+    {
+        return value;
+    }
+};
+
+template <typename T>
+    requires requires { typename SqlDataBinder<T>::ArrayElementType; }
+struct SqlParameterArrayElement<T>
+{
+    using type = typename SqlDataBinder<T>::ArrayElementType;
+
+    static LIGHTWEIGHT_FORCE_INLINE constexpr type From(T const& value) noexcept
+    {
+        return SqlDataBinder<T>::ToArrayElement(value);
+    }
+};
+
+} // namespace detail
+
+// Binders that can bind a contiguous array of values along with a length/indicator array (e.g. for NULL values),
+// used for array-bound batch execution.
+template <typename T>
+concept SqlInputParameterArrayBinder =
+    requires(SQLHSTMT hStmt,
+             SQLUSMALLINT column,
+             typename detail::SqlParameterArrayElement<T>::type const* values,
+             SQLLEN* indicators,
+             SqlDataBinderCallback& cb) {
+        { SqlDataBinder<T>::InputParameterArray(hStmt, column, values, indicators, cb) } -> std::same_as<SQLRETURN>;
+    };
+
 template <typename T>
 concept SqlOutputColumnBinder =
     requires(SQLHSTMT hStmt, SQLUSMALLINT column, T* result, SQLLEN* indicator, SqlDataBinderCallback& cb) {
@@ -19,6 +19,16 @@ struct SqlSimpleDataBinder
             stmt, column, SQL_PARAM_INPUT, TheCType, TheSqlType, 0, 0, (SQLPOINTER) &value, 0, nullptr);
     }
 
+    static LIGHTWEIGHT_FORCE_INLINE SQLRETURN InputParameterArray(SQLHSTMT stmt,
+                                                                  SQLUSMALLINT column,
+                                                                  T const* values,
+                                                                  SQLLEN* indicators,
+                                                                  SqlDataBinderCallback& /*cb*/) noexcept
+    {
+        return SQLBindParameter(
+            stmt, column, SQL_PARAM_INPUT, TheCType, TheSqlType, 0, 0, (SQLPOINTER) values, sizeof(T), indicators);
+    }
+
     static LIGHTWEIGHT_FORCE_INLINE SQLRETURN OutputColumn(
         SQLHSTMT stmt, SQLUSMALLINT column, T* result, SQLLEN* indicator, SqlDataBinderCallback& /*unused*/) noexcept
     {
@@ -108,6 +108,24 @@ struct LIGHTWEIGHT_API SqlDataBinder<SqlDate>
                                 nullptr);
     }
 
+    static LIGHTWEIGHT_FORCE_INLINE SQLRETURN InputParameterArray(SQLHSTMT stmt,
+                                                                  SQLUSMALLINT column,
+                                                                  SqlDate const* values,
+                                                                  SQLLEN* indicators,
+                                                                  SqlDataBinderCallback& /*cb*/) noexcept
+    {
+        return SQLBindParameter(stmt,
+                                column,
+                                SQL_PARAM_INPUT,
+                                SQL_C_TYPE_DATE,
+                                SQL_TYPE_DATE,
+                                0,
+                                0,
+                                (SQLPOINTER) &values->sqlValue,
+                                0,
+                                indicators);
+    }
+
     static LIGHTWEIGHT_FORCE_INLINE SQLRETURN OutputColumn(
         SQLHSTMT stmt, SQLUSMALLINT column, SqlDate* result, SQLLEN* indicator, SqlDataBinderCallback& /*cb*/) noexcept
     {
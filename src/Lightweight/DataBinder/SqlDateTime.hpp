@@ -159,6 +159,24 @@ struct LIGHTWEIGHT_API SqlDataBinder<SqlDateTime>
                                 nullptr);
     }
 
+    static LIGHTWEIGHT_FORCE_INLINE SQLRETURN InputParameterArray(SQLHSTMT stmt,
+                                                                  SQLUSMALLINT column,
+                                                                  SqlDateTime const* values,
+                                                                  SQLLEN* indicators,
+                                                                  SqlDataBinderCallback& /*cb*/) noexcept
+    {
+        return SQLBindParameter(stmt,
+                                column,
+                                SQL_PARAM_INPUT,
+                                SQL_C_TIMESTAMP,
+                                SQL_TYPE_TIMESTAMP,
+                                27,
+                                7,
+                                (SQLPOINTER) &values->sqlValue,
+                                sizeof(SqlDateTime),
+                                indicators);
+    }
+
     static LIGHTWEIGHT_FORCE_INLINE SQLRETURN OutputColumn(SQLHSTMT stmt,
                                                            SQLUSMALLINT column,
                                                            SqlDateTime* result,
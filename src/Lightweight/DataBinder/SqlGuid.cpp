@@ -155,8 +155,18 @@ SQLRETURN SqlDataBinder<SqlGuid>::OutputColumn(
             auto text = std::make_shared<std::string>();
             auto rv = SqlDataBinder<std::string>::OutputColumn(stmt, column, text.get(), indicator, cb);
             if (SQL_SUCCEEDED(rv))
-                cb.PlanPostProcessOutputColumn(
-                    [text = std::move(text), result] { *result = SqlGuid::TryParse(*text).value_or(SqlGuid {}); });
+                cb.PlanPostProcessOutputColumn(SqlOutputColumnFixup {
+                    .postProcess =
+                        [](SqlOutputColumnFixup& fixup) {
+                            auto const& text = *std::static_pointer_cast<std::string>(fixup.state);
+                            *static_cast<SqlGuid*>(fixup.result) = SqlGuid::TryParse(text).value_or(SqlGuid {});
+                        },
+                    .stmt = stmt,
+                    .column = column,
+                    .result = result,
+                    .indicator = indicator,
+                    .state = std::move(text), // Also keeps the string bound above alive
+                });
             return rv;
         }
         case SqlServerType::ORACLE:
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <vector>
+
+/// Kind of data streamed to or from a large TEXT or BLOB column.
+enum class SqlStreamType : std::uint8_t
+{
+    /// Raw bytes, transferred as SQL_C_BINARY.
+    BINARY,
+
+    /// Narrow character data, transferred as SQL_C_CHAR.
+    TEXT,
+};
+
+/// @brief Input parameter whose value is streamed to the server in chunks, while executing the statement.
+///
+/// The parameter is bound as data-at-execution parameter (SQL_DATA_AT_EXEC). When executing the statement,
+/// the reader is called repeatedly to fill a chunk buffer, until it returns 0, and each chunk is handed to
+/// the driver via SQLPutData(). This allows inserting values of hundreds of megabytes, without ever
+/// holding them in memory at once.
+///
+/// The stream object must be alive until the statement has been executed.
+///
+/// @code
+/// auto file = std::ifstream { "image.png", std::ios::binary };
+/// stmt.Prepare(stmt.Query("Images").Insert().Set("name", SqlWildcard).Set("data", SqlWildcard));
+/// stmt.Execute("image.png", SqlInputStream::From(file));
+/// @endcode
+struct SqlInputStream
+{
+    /// Fills the given buffer with the next chunk of data, returning the number of bytes written, or 0 at the end.
+    using Reader = std::function<std::size_t(std::span<std::byte> buffer)>;
+
+    /// Size of the chunks handed to the driver.
+    static constexpr std::size_t ChunkSize = 64 * 1024;
+
+    Reader reader;
+    SqlStreamType type = SqlStreamType::BINARY;
+
+    /// The total number of bytes to be streamed, if known upfront.
+    /// Some drivers require it to be known (see SQL_NEED_LONG_DATA_LEN).
+    std::optional<std::size_t> length = std::nullopt;
+
+    /// Constructs an input stream reading the given std::istream until its end.
+    static SqlInputStream From(std::istream& stream, SqlStreamType type = SqlStreamType::BINARY)
+    {
+        return SqlInputStream {
+            .reader =
+                [&stream](std::span<std::byte> buffer) -> std::size_t {
+                stream.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+                return static_cast<std::size_t>(stream.gcount());
+            },
+            .type = type,
+        };
+    }
+};
+
+/// @brief Receives a column value streamed from the server in chunks, when fetched via SqlStatement::GetColumn().
+///
+/// The value is retrieved piecewise via repeated SQLGetData() calls into a buffer of chunkSize bytes,
+/// and each chunk is passed to the writer. A NULL value results in no call to the writer.
+///
+/// @code
+/// auto file = std::ofstream { "image.png", std::ios::binary };
+/// auto sink = SqlOutputStream::To(file);
+/// (void) stmt.GetColumn(1, &sink);
+/// @endcode
+struct SqlOutputStream
+{
+    /// Consumes the next chunk of the column value.
+    using Writer = std::function<void(std::span<std::byte const> chunk)>;
+
+    Writer writer;
+    SqlStreamType type = SqlStreamType::BINARY;
+
+    /// Size of the chunks retrieved from the driver.
+    std::size_t chunkSize = 64 * 1024;
+
+    /// Constructs an output stream writing to the given std::ostream.
+    static SqlOutputStream To(std::ostream& stream, SqlStreamType type = SqlStreamType::BINARY)
+    {
+        return SqlOutputStream {
+            .writer =
+                [&stream](std::span<std::byte const> chunk) {
+                stream.write(reinterpret_cast<char const*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+            },
+            .type = type,
+        };
+    }
+};
+
+template <>
+struct SqlDataBinder<SqlInputStream>
+{
+    static SQLRETURN InputParameter(SQLHSTMT stmt,
+                                    SQLUSMALLINT column,
+                                    SqlInputStream const& value,
+                                    SqlDataBinderCallback& cb) noexcept
+    {
+        auto const isText = value.type == SqlStreamType::TEXT;
+
+        // The indicator is read by the driver when executing the statement, so it must outlive this call.
+        auto indicator = std::make_shared<SQLLEN>(
+            value.length ? SQL_LEN_DATA_AT_EXEC(static_cast<SQLLEN>(*value.length)) : SQL_DATA_AT_EXEC);
+        cb.PlanPostExecuteCallback([indicator] {});
+
+        // The address of the stream is passed as token, being handed back by SQLParamData() (see PutData()).
+        return SQLBindParameter(stmt,
+                                column,
+                                SQL_PARAM_INPUT,
+                                isText ? SQL_C_CHAR : SQL_C_BINARY,
+                                isText ? SQL_LONGVARCHAR : SQL_LONGVARBINARY,
+                                value.length.value_or(0),
+                                0,
+                                (SQLPOINTER) &value,
+                                0,
+                                indicator.get());
+    }
+
+    // Streams the value of the data-at-execution parameter to the driver, after SQLParamData() requested it.
+    static SQLRETURN PutData(SQLHSTMT stmt, SqlInputStream const& value)
+    {
+        auto buffer = std::vector<std::byte>(SqlInputStream::ChunkSize);
+
+        // An empty value is put as a single empty chunk, as a parameter without any chunk would be NULL.
+        auto chunkSize = value.reader(buffer);
+        do
+        {
+            if (auto const result = SQLPutData(stmt, buffer.data(), static_cast<SQLLEN>(chunkSize));
+                !SQL_SUCCEEDED(result))
+                return result;
+        } while ((chunkSize = value.reader(buffer)) != 0);
+
+        return SQL_SUCCESS;
+    }
+};
+
+template <>
+struct SqlDataBinder<SqlOutputStream>
+{
+    static SQLRETURN GetColumn(SQLHSTMT stmt,
+                               SQLUSMALLINT column,
+                               SqlOutputStream* result,
+                               SQLLEN* indicator,
+                               SqlDataBinderCallback const& /*cb*/)
+    {
+        auto const isText = result->type == SqlStreamType::TEXT;
+        auto const cType = isText ? SQL_C_CHAR : SQL_C_BINARY;
+        auto const capacity = (std::max)(result->chunkSize, std::size_t { 1 });
+
+        // Text chunks are always null-terminated by the driver, which does not count to the chunk.
+        auto buffer = std::vector<std::byte>(capacity + (isText ? 1 : 0));
+
+        while (true)
+        {
+            auto const rv =
+                SQLGetData(stmt, column, cType, buffer.data(), static_cast<SQLLEN>(buffer.size()), indicator);
+            if (rv == SQL_NO_DATA)
+                return SQL_SUCCESS; // All chunks have been retrieved
+            if (!SQL_SUCCEEDED(rv))
+                return rv;
+            if (*indicator == SQL_NULL_DATA)
+                return SQL_SUCCESS;
+
+            // A truncated chunk fills the buffer, and the indicator holds the remaining length (or SQL_NO_TOTAL).
+            auto const truncated = *indicator == SQL_NO_TOTAL || static_cast<std::size_t>(*indicator) > capacity;
+            auto const chunkSize = truncated ? capacity : static_cast<std::size_t>(*indicator);
+            result->writer(std::span<std::byte const> { buffer.data(), chunkSize });
+
+            if (rv == SQL_SUCCESS)
+                return SQL_SUCCESS;
+        }
+    }
+};
@@ -130,6 +130,37 @@ struct SqlDataBinder<SqlTime>
                                 nullptr);
     }
 
+    // Arrays are bound as SQL_C_TYPE_TIME, which the driver steps through by sizeof(SQL_TIME_STRUCT),
+    // so they must not hold the (larger) SqlTime values themselves.
+    using ArrayElementType = SQL_TIME_STRUCT;
+
+    static LIGHTWEIGHT_FORCE_INLINE constexpr SQL_TIME_STRUCT ToArrayElement(SqlTime const& value) noexcept
+    {
+        return SQL_TIME_STRUCT {
+            .hour = value.sqlValue.hour,
+            .minute = value.sqlValue.minute,
+            .second = value.sqlValue.second,
+        };
+    }
+
+    static LIGHTWEIGHT_FORCE_INLINE SQLRETURN InputParameterArray(SQLHSTMT stmt,
+                                                                  SQLUSMALLINT column,
+                                                                  SQL_TIME_STRUCT const* values,
+                                                                  SQLLEN* indicators,
+                                                                  SqlDataBinderCallback& /*cb*/) noexcept
+    {
+        return SQLBindParameter(stmt,
+                                column,
+                                SQL_PARAM_INPUT,
+                                SQL_C_TYPE_TIME,
+                                SQL_TYPE_TIME,
+                                0,
+                                0,
+                                (SQLPOINTER) values,
+                                sizeof(SQL_TIME_STRUCT),
+                                indicators);
+    }
+
     static LIGHTWEIGHT_FORCE_INLINE SQLRETURN OutputColumn(
         SQLHSTMT stmt, SQLUSMALLINT column, SqlTime* result, SQLLEN* indicator, SqlDataBinderCallback& /*cb*/) noexcept
     {
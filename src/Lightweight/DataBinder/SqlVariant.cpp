@@ -18,10 +18,16 @@ SQLRETURN SqlDataBinder<SqlVariant>::GetColumn(
     SQLHSTMT stmt, SQLUSMALLINT column, SqlVariant* result, SQLLEN* indicator, SqlDataBinderCallback const& cb) noexcept
 {
     SQLLEN columnType {};
-    SQLRETURN returnCode =
-        SQLColAttributeA(stmt, static_cast<SQLSMALLINT>(column), SQL_DESC_TYPE, nullptr, 0, nullptr, &columnType);
-    if (!SQL_SUCCEEDED(returnCode))
-        return returnCode;
+    SQLRETURN returnCode = SQL_SUCCESS;
+    if (auto const* metadata = cb.DescribeColumn(column); metadata)
+        columnType = metadata->sqlType;
+    else
+    {
+        returnCode =
+            SQLColAttributeA(stmt, static_cast<SQLSMALLINT>(column), SQL_DESC_TYPE, nullptr, 0, nullptr, &columnType);
+        if (!SQL_SUCCEEDED(returnCode))
+            return returnCode;
+    }
 
     auto& variant = result->value;
 
@@ -78,8 +84,9 @@ SQLRETURN SqlDataBinder<SqlVariant>::GetColumn(
             returnCode = SqlDataBinder<SqlDate>::GetColumn(stmt, column, &variant.emplace<SqlDate>(), indicator, cb);
             break;
         case SQL_TIME:
-            SqlLogger::GetLogger().OnWarning(
-                std::format("SQL_TIME is from ODBC 2. SQL_TYPE_TIME should have been received instead."));
+            if (SqlLogger::IsEnabled(SqlLogger::Event::WARNINGS))
+                SqlLogger::GetLogger().OnWarning(
+                    std::format("SQL_TIME is from ODBC 2. SQL_TYPE_TIME should have been received instead."));
             [[fallthrough]];
         case SQL_TYPE_TIME:
         case SQL_SS_TIME2:
@@ -123,7 +130,8 @@ SQLRETURN SqlDataBinder<SqlVariant>::GetColumn(
             // TODO: Get them implemented on demand
             [[fallthrough]];
         default:
-            SqlLogger::GetLogger().OnError(SqlError::UNSUPPORTED_TYPE);
+            if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+                SqlLogger::GetLogger().OnError(SqlError::UNSUPPORTED_TYPE);
             returnCode = SQL_ERROR; // std::errc::invalid_argument;
     }
     if (indicator && *indicator == SQL_NULL_DATA)
@@ -36,9 +36,22 @@ struct SqlDataBinder<std::optional<T>>
             return SQL_ERROR;
 
         auto const sqlReturn = SqlDataBinder<T>::OutputColumn(stmt, column, &result->emplace(), indicator, cb);
-        cb.PlanPostProcessOutputColumn([result, indicator]() {
-            if (indicator && *indicator == SQL_NULL_DATA)
-                *result = std::nullopt;
+        cb.PlanPostProcessOutputColumn(SqlOutputColumnFixup {
+            .postProcess =
+                [](SqlOutputColumnFixup& fixup) {
+                    if (fixup.indicator && *fixup.indicator == SQL_NULL_DATA)
+                        *static_cast<OptionalValue*>(fixup.result) = std::nullopt;
+                },
+            .prepareFetch =
+                [](SqlOutputColumnFixup& fixup) {
+                    // The value is bound in place, so it must exist again after a NULL has been fetched.
+                    if (auto* const result = static_cast<OptionalValue*>(fixup.result); !result->has_value())
+                        result->emplace();
+                },
+            .stmt = stmt,
+            .column = column,
+            .result = result,
+            .indicator = indicator,
         });
         return sqlReturn;
     }
@@ -11,6 +11,7 @@
 #include "SqlRealName.hpp"
 
 #include <compare>
+#include <memory>
 #include <optional>
 #include <string_view>
 #include <type_traits>
@@ -59,19 +60,49 @@ class BelongsTo
     {
     }
 
-    constexpr BelongsTo(ReferencedRecord const& other) noexcept:
+    BelongsTo(ReferencedRecord const& other):
         _referencedFieldValue { (other.*ReferencedField).Value() },
         _loaded { true },
-        _record { other }
+        _record { std::make_shared<ReferencedRecord>(other) }
     {
     }
 
+    /// Copies the relationship. A loaded record is copied as well, unless it is the DataMapper's
+    /// identity map instance, which all copies keep sharing.
+    BelongsTo(BelongsTo const& other):
+        _referencedFieldValue { other._referencedFieldValue },
+        _loader { other._loader },
+        _loaded { other._loaded },
+        _modified { other._modified },
+        _identityMapped { other._identityMapped },
+        _record { other.CopyRecord() }
+    {
+    }
+
+    BelongsTo& operator=(BelongsTo const& other)
+    {
+        if (this == &other)
+            return *this;
+        _referencedFieldValue = other._referencedFieldValue;
+        _loader = other._loader;
+        _loaded = other._loaded;
+        _modified = other._modified;
+        _identityMapped = other._identityMapped;
+        _record = other.CopyRecord();
+        return *this;
+    }
+
+    BelongsTo(BelongsTo&&) noexcept = default;
+    BelongsTo& operator=(BelongsTo&&) noexcept = default;
+    ~BelongsTo() = default;
+
     BelongsTo& operator=(SqlNullType /*nullValue*/) noexcept
     {
         if (!_referencedFieldValue)
             return *this;
         _loaded = false;
-        _record = std::nullopt;
+        _identityMapped = false;
+        _record.reset();
         _referencedFieldValue = {};
         _modified = true;
         return *this;
@@ -82,7 +113,8 @@ class BelongsTo
         if (_referencedFieldValue == (other.*ReferencedField).Value())
             return *this;
         _loaded = true;
-        _record.emplace(other);
+        _identityMapped = false;
+        _record = std::make_shared<ReferencedRecord>(other);
         _referencedFieldValue = (other.*ReferencedField).Value();
         _modified = true;
         return *this;
@@ -103,28 +135,28 @@ class BelongsTo
     [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ValueType& MutableValue() noexcept { return _referencedFieldValue; }
 
     /// Retrieves a record from the relationship.
-    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord& Record() noexcept { RequireLoaded(); return _record.value(); }
+    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord& Record() noexcept { RequireLoaded(); return *_record; }
 
     /// Retrieves an immutable reference to the record from the relationship.
-    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord const& Record() const noexcept { RequireLoaded(); return _record.value(); }
+    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord const& Record() const noexcept { RequireLoaded(); return *_record; }
 
     /// Checks if the record is loaded into memory.
     [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr bool IsLoaded() const noexcept { return _loaded; }
 
     /// Unloads the record from memory.
-    LIGHTWEIGHT_FORCE_INLINE void Unload() noexcept { _record = std::nullopt; _loaded = false; }
+    LIGHTWEIGHT_FORCE_INLINE void Unload() noexcept { _record.reset(); _loaded = false; _identityMapped = false; }
 
     /// Retrieves the record from the relationship.
-    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord& operator*() noexcept { RequireLoaded(); return _record.value(); }
+    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord& operator*() noexcept { RequireLoaded(); return *_record; }
 
     /// Retrieves the record from the relationship.
-    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord const& operator*() const noexcept { RequireLoaded(); return _record.value(); }
+    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord const& operator*() const noexcept { RequireLoaded(); return *_record; }
 
     /// Retrieves the record from the relationship.
-    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord* operator->() noexcept { RequireLoaded(); return &_record.value(); }
+    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord* operator->() noexcept { RequireLoaded(); return _record.get(); }
 
     /// Retrieves the record from the relationship.
-    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord const* operator->() const noexcept { RequireLoaded(); return &_record.value(); }
+    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord const* operator->() const noexcept { RequireLoaded(); return _record.get(); }
 
     /// Checks if the field value is NULL.
     [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr bool operator!() const noexcept { return !_referencedFieldValue; }
@@ -133,7 +165,11 @@ class BelongsTo
     [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr explicit operator bool() const noexcept { return static_cast<bool>(_referencedFieldValue); }
 
     /// Emplaces a record into the relationship. This will mark the relationship as loaded.
-    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr ReferencedRecord& EmplaceRecord() { _loaded = true; return _record.emplace(); }
+    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE ReferencedRecord& EmplaceRecord() { _loaded = true; _identityMapped = false; _record = std::make_shared<ReferencedRecord>(); return *_record; }
+
+    /// Emplaces a record instance that may be shared with other relations. This will mark the relationship as loaded.
+    /// Copies of this relationship keep sharing the instance only if it is owned by the DataMapper's identity map.
+    LIGHTWEIGHT_FORCE_INLINE void EmplaceRecord(std::shared_ptr<ReferencedRecord> record, bool identityMapped = false) noexcept { _loaded = true; _identityMapped = identityMapped; _record = std::move(record); }
 
     LIGHTWEIGHT_FORCE_INLINE void BindOutputColumn(SQLSMALLINT outputIndex, SqlStatement& stmt) { stmt.BindOutputColumn(outputIndex, &_referencedFieldValue); }
     // clang-format on
@@ -186,6 +222,13 @@ class BelongsTo
     }
 
   private:
+    std::shared_ptr<ReferencedRecord> CopyRecord() const
+    {
+        if (_identityMapped || !_record)
+            return _record;
+        return std::make_shared<ReferencedRecord>(*_record);
+    }
+
     void RequireLoaded()
     {
         if (_loaded)
@@ -201,7 +244,9 @@ class BelongsTo
     Loader _loader {};
     bool _loaded = false;
     bool _modified = false;
-    std::optional<ReferencedRecord> _record {};
+    bool _identityMapped = false; // Whether the record is the identity map's instance, shared across copies.
+    // Shared, so that records loaded via the DataMapper's identity map exist only once in memory.
+    std::shared_ptr<ReferencedRecord> _record {};
 };
 
 template <auto ReferencedField>
@@ -247,7 +292,13 @@ struct SqlDataBinder<BelongsTo<ReferencedField>>
     {
         auto const sqlReturn =
             SqlDataBinder<InnerType>::OutputColumn(stmt, column, &result->MutableValue(), indicator, cb);
-        cb.PlanPostProcessOutputColumn([result]() { result->SetModified(true); });
+        cb.PlanPostProcessOutputColumn(SqlOutputColumnFixup {
+            .postProcess = [](SqlOutputColumnFixup& fixup) { static_cast<SelfType*>(fixup.result)->SetModified(true); },
+            .stmt = stmt,
+            .column = column,
+            .result = result,
+            .indicator = indicator,
+        });
         return sqlReturn;
     }
 
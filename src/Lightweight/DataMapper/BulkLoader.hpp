@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "../SqlConnection.hpp"
+#include "../SqlStatement.hpp"
+#include "../SqlTransaction.hpp"
+#include "DataMapper.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+/// Mechanism used by SqlBulkLoader to send a batch of records to the server.
+enum class SqlBulkLoadMethod : std::uint8_t
+{
+    /// A single INSERT statement, executed once per batch with array-bound parameters.
+    PARAMETER_ARRAYS,
+
+    /// INSERT statements with as many rows in their VALUES list as the server permits (see ExecuteInsertRows()).
+    MULTI_ROW_VALUES,
+};
+
+/// Configuration of a SqlBulkLoader.
+struct SqlBulkLoaderConfig
+{
+    /// Number of records buffered on the client before being sent to the server.
+    std::size_t batchSize = 10'000;
+
+    /// Number of records after which the transaction of the loader is committed, and a new one is started.
+    /// Zero commits only once, when finishing the load.
+    std::size_t commitInterval = 100'000;
+
+    /// Mechanism to send the batches with, or std::nullopt to use the fastest one for the connected server.
+    std::optional<SqlBulkLoadMethod> method;
+};
+
+/// @brief Streams large numbers of records into their table, as fast as the connected server permits.
+///
+/// Records are buffered column-wise on the client, and sent to the server in batches of
+/// SqlBulkLoaderConfig::batchSize records. Batches are inserted within a transaction that is committed
+/// every SqlBulkLoaderConfig::commitInterval records, saving the per-statement commit (and, for SQLite,
+/// the journal sync) that dominates the cost of auto-committed inserts.
+/// If a transaction is already active on the connection, the batches are inserted within that one instead.
+///
+/// PostgreSQL (whose ODBC driver executes parameter arrays row by row) is loaded with multi-row VALUES lists,
+/// all other servers with parameter arrays.
+///
+/// Primary keys auto-incremented by the server are generated by the server, but not retrieved.
+/// All other primary keys must be set by the caller.
+///
+/// @code
+/// auto loader = SqlBulkLoader<Measurement> { connection, { .batchSize = 5'000 } };
+/// for (auto const& measurement: measurements)
+///     loader.Add(measurement);
+/// loader.Finish();
+/// @endcode
+///
+/// @note Records not committed by Finish() (or a commit interval) are rolled back when the loader is destroyed.
+///
+/// @ingroup DataMapper
+template <typename Record>
+class SqlBulkLoader final
+{
+  public:
+    /// Constructs a bulk loader inserting records into the table of @p Record on the given connection.
+    explicit SqlBulkLoader(SqlConnection& connection, SqlBulkLoaderConfig config = {});
+
+    SqlBulkLoader(SqlBulkLoader const&) = delete;
+    SqlBulkLoader(SqlBulkLoader&&) = delete;
+    SqlBulkLoader& operator=(SqlBulkLoader const&) = delete;
+    SqlBulkLoader& operator=(SqlBulkLoader&&) = delete;
+    ~SqlBulkLoader() = default;
+
+    /// Retrieves the mechanism used to send the batches to the server.
+    [[nodiscard]] SqlBulkLoadMethod Method() const noexcept
+    {
+        return m_method;
+    }
+
+    /// Retrieves the number of records sent to the server so far.
+    [[nodiscard]] std::size_t RowsLoaded() const noexcept
+    {
+        return m_rowsLoaded;
+    }
+
+    /// Adds a record to the load, sending the current batch to the server if it is full.
+    void Add(Record const& record);
+
+    /// Adds the given records to the load.
+    template <std::ranges::input_range Records>
+    void AddAll(Records const& records)
+    {
+        for (Record const& record: records)
+            Add(record);
+    }
+
+    /// Sends the currently buffered records to the server.
+    ///
+    /// If sending them fails, the buffered records are discarded before the exception propagates,
+    /// and the records sent before are left to the transaction (see Finish()).
+    void Flush();
+
+    /// Sends the remaining records to the server and commits them.
+    ///
+    /// @return The total number of records loaded.
+    std::size_t Finish();
+
+  private:
+    using Columns = detail::RecordInsertColumns<Record>;
+
+    SqlBulkLoaderConfig m_config;
+    SqlBulkLoadMethod m_method;
+    SqlStatement m_stmt;
+    std::optional<SqlTransaction> m_transaction;
+    Columns m_columns;
+    std::size_t m_bufferedRowCount = 0;
+    std::size_t m_uncommittedRowCount = 0;
+    std::size_t m_rowsLoaded = 0;
+};
+
+template <typename Record>
+SqlBulkLoader<Record>::SqlBulkLoader(SqlConnection& connection, SqlBulkLoaderConfig config):
+    m_config { config },
+    m_method { config.method.value_or(connection.ServerType() == SqlServerType::POSTGRESQL
+                                          ? SqlBulkLoadMethod::MULTI_ROW_VALUES
+                                          : SqlBulkLoadMethod::PARAMETER_ARRAYS) },
+    m_stmt { connection }
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    if (m_config.batchSize == 0)
+        throw std::invalid_argument { "The batch size must not be zero" };
+
+    std::apply([&](auto&... column) { (column.reserve(m_config.batchSize), ...); }, m_columns);
+}
+
+template <typename Record>
+void SqlBulkLoader<Record>::Add(Record const& record)
+{
+    Reflection::EnumerateMembers(record, [&]<size_t I, typename FieldType>(FieldType const& field) {
+        if constexpr (detail::IsInsertedColumn<FieldType>)
+            std::get<detail::RecordInsertColumnIndex<Record, I>>(m_columns).emplace_back(field.Value());
+    });
+
+    if (++m_bufferedRowCount >= m_config.batchSize)
+        Flush();
+}
+
+template <typename Record>
+void SqlBulkLoader<Record>::Flush()
+{
+    if (m_bufferedRowCount == 0)
+        return;
+
+    // The buffered records are discarded even if sending them fails, as they would be sent again otherwise.
+    auto const bufferedRowCount = std::exchange(m_bufferedRowCount, 0);
+    auto const _ = detail::Finally([this] { std::apply([](auto&... column) { (column.clear(), ...); }, m_columns); });
+
+    auto& connection = m_stmt.Connection();
+    if (!m_transaction && !connection.TransactionActive())
+        m_transaction.emplace(connection, SqlTransactionMode::ROLLBACK);
+
+    switch (m_method)
+    {
+        case SqlBulkLoadMethod::PARAMETER_ARRAYS: {
+            auto const& insertAll = RecordStatementsOf<Record>(connection.ServerType()).insertAll;
+            if (m_stmt.PreparedQuery() != insertAll)
+                m_stmt.Prepare(insertAll);
+            std::apply([this](auto const&... column) { m_stmt.ExecuteBatch(column...); }, m_columns);
+            break;
+        }
+        case SqlBulkLoadMethod::MULTI_ROW_VALUES:
+            std::apply(
+                [this](auto const&... column) {
+                    m_stmt.ExecuteInsertRows(
+                        RecordTableName<Record>, detail::RecordInsertColumnNames<Record>(), column...);
+                },
+                m_columns);
+            break;
+    }
+
+    m_rowsLoaded += bufferedRowCount;
+    m_uncommittedRowCount += bufferedRowCount;
+
+    if (m_transaction && m_config.commitInterval != 0 && m_uncommittedRowCount >= m_config.commitInterval)
+    {
+        m_transaction->Commit();
+        m_transaction.reset();
+        m_uncommittedRowCount = 0;
+    }
+}
+
+template <typename Record>
+std::size_t SqlBulkLoader<Record>::Finish()
+{
+    Flush();
+
+    if (m_transaction)
+    {
+        m_transaction->Commit();
+        m_transaction.reset();
+        m_uncommittedRowCount = 0;
+    }
+
+    return m_rowsLoaded;
+}
@@ -4,19 +4,39 @@
 #include "../SqlConnection.hpp"
 #include "../SqlDataBinder.hpp"
 #include "../SqlStatement.hpp"
+#include "../SqlTransaction.hpp"
 #include "BelongsTo.hpp"
 #include "Field.hpp"
 #include "HasMany.hpp"
 #include "HasManyThrough.hpp"
 #include "HasOneThrough.hpp"
+#include "IdentityMap.hpp"
 #include "Record.hpp"
 #include "RecordId.hpp"
 
 #include <reflection-cpp/reflection.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <charconv>
 #include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 /// @defgroup DataMapper Data Mapper
 ///
@@ -60,6 +80,139 @@ auto ToSharedPtrList(Container<Object, Allocator<Object>> container)
 
 } // namespace detail
 
+/// @brief Lazy input range of records, fetched one by one from the result set of a query.
+///
+/// The output columns are bound once, and every row is fetched into the same record,
+/// so that arbitrarily large result sets can be processed with constant memory.
+/// Advancing invalidates the previously yielded record (and unloads its relations), so copy it to keep it.
+///
+/// The stream uses its own statement and must not outlive the DataMapper that created it.
+///
+/// @code
+/// auto names = dm.Stream<Person>(query.All())
+///     | std::views::filter([](Person const& person) { return person.is_active.Value(); })
+///     | std::views::transform([](Person const& person) { return person.name.Value(); });
+/// @endcode
+///
+/// @see DataMapper::Stream()
+/// @ingroup DataMapper
+template <typename Record>
+class RecordStream: public std::ranges::view_interface<RecordStream<Record>>
+{
+    // Kept on the heap, as the bound output columns refer to the record.
+    struct State
+    {
+        SqlStatement stmt;
+        Record record {};
+        bool started = false;
+        bool done = false;
+
+        void FetchNext()
+        {
+            Reflection::EnumerateMembers(record, []<size_t I, typename FieldType>(FieldType& field) {
+                if constexpr (IsBelongsTo<FieldType> || IsHasMany<FieldType> || IsHasOneThrough<FieldType>
+                              || IsHasManyThrough<FieldType>)
+                    field.Unload();
+            });
+            done = !stmt.FetchRow();
+        }
+    };
+
+  public:
+    /// Input iterator over the fetched records.
+    class iterator
+    {
+      public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = Record;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        explicit iterator(State* state) noexcept:
+            _state { state }
+        {
+        }
+
+        Record& operator*() const noexcept
+        {
+            return _state->record;
+        }
+
+        Record* operator->() const noexcept
+        {
+            return &_state->record;
+        }
+
+        iterator& operator++()
+        {
+            _state->FetchNext();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool operator==(std::default_sentinel_t /*sentinel*/) const noexcept
+        {
+            return !_state || _state->done;
+        }
+
+      private:
+        State* _state = nullptr;
+    };
+
+    /// Fetches the first record and returns an iterator to it.
+    ///
+    /// @note As this is an input range, it can only be iterated once.
+    iterator begin()
+    {
+        if (!_state->started)
+        {
+            _state->started = true;
+            _state->FetchNext();
+        }
+        return iterator { _state.get() };
+    }
+
+    std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+  private:
+    friend class DataMapper;
+
+    explicit RecordStream(SqlStatement&& stmt):
+        _state { std::make_unique<State>(State { .stmt = std::move(stmt) }) }
+    {
+    }
+
+    std::unique_ptr<State> _state;
+};
+
+/// @brief Selects the relations of a record to be eagerly loaded along with the queried records.
+///
+/// Each relation is given as member pointer to a HasMany or BelongsTo member of the queried record.
+/// The related records of all queried records are loaded with one query per relation
+/// (per chunk of keys), instead of one query per record and relation.
+///
+/// @code
+/// auto users = dm.All<User>(Include<&User::emails>());
+/// for (auto& user: users)
+///     for (auto const& email: user.emails) // no extra query
+///         std::println("{}: {}", user.name.Value(), email->address.Value());
+/// @endcode
+///
+/// @see DataMapper::Query(), DataMapper::All(), DataMapper::LoadRelations()
+/// @ingroup DataMapper
+template <auto... Relations>
+struct Include
+{
+};
+
 /// @brief Main API for mapping records to and from the database using high level C++ syntax.
 ///
 /// @see Field, BelongsTo, HasMany, HasManyThrough, HasOneThrough
@@ -99,6 +252,41 @@ class DataMapper
         return _connection;
     }
 
+    /// @brief Enables or disables the identity map of this data mapper.
+    ///
+    /// When enabled, records queried by primary key, and records loaded through BelongsTo relations,
+    /// are kept in the identity map and reused by subsequent lookups of the same primary key,
+    /// instead of being queried again. Records loaded through BelongsTo relations share the same instance.
+    ///
+    /// Update() and Delete() invalidate the affected records. Changes made to the database by other means
+    /// require an explicit ClearIdentityMap().
+    ///
+    /// Disabling the identity map clears it. It is disabled by default.
+    void EnableIdentityMap(bool enabled = true) noexcept
+    {
+        _identityMapEnabled = enabled;
+        if (!enabled)
+            _identityMap.Clear();
+    }
+
+    /// Checks if the identity map is enabled.
+    [[nodiscard]] bool IsIdentityMapEnabled() const noexcept
+    {
+        return _identityMapEnabled;
+    }
+
+    /// Removes all records from the identity map.
+    void ClearIdentityMap() noexcept
+    {
+        _identityMap.Clear();
+    }
+
+    /// Returns the identity map of this data mapper.
+    [[nodiscard]] IdentityMap const& Identities() const noexcept
+    {
+        return _identityMap;
+    }
+
     /// Constructs a human readable string representation of the given record.
     template <typename Record>
     static std::string Inspect(Record const& record);
@@ -135,6 +323,36 @@ class DataMapper
     template <typename Record>
     RecordId CreateExplicit(Record const& record);
 
+    /// @brief Creates the given records in the database, all in one go.
+    ///
+    /// The records are inserted by a single execution of the INSERT statement with array-bound parameters.
+    /// Records whose inserted columns are all of fixed-size native types are bound row-wise in place,
+    /// others are copied into per-column parameter arrays first.
+    ///
+    /// Auto-assigned primary keys are assigned to all records upfront.
+    ///
+    /// Records with an auto-incremented primary key are inserted with multi-row INSERT queries instead
+    /// (see SqlStatement::ExecuteInsertRowsReturning()), which return the generated keys themselves.
+    /// If the server cannot return generated keys from an INSERT, the records are created one by one.
+    template <typename Record>
+    void CreateAll(std::span<Record> records);
+
+    /// @brief Creates the record in the database, or updates it if a record with the same primary key exists.
+    ///
+    /// This is a single server-side upsert (`INSERT ... ON CONFLICT` or `MERGE`), so that the record
+    /// does not need to be queried first, and concurrent saves of the same record do not race.
+    /// An auto-assigned primary key that is not set yet is assigned first, just like Create() does.
+    ///
+    /// @note The primary key must not be auto-incremented by the server, as it identifies the record to update.
+    template <typename Record>
+    void Save(Record& record);
+
+    /// @brief Creates or updates the given records in the database, all in one go.
+    ///
+    /// Like Save(), but the upsert statement is executed once, with array-bound parameters for all records.
+    template <typename Record>
+    void SaveAll(std::span<Record> records);
+
     /// @brief Queries a single record from the database based on the given query.
     ///
     /// @param selectQuery The SQL select query to execute.
@@ -168,6 +386,30 @@ class DataMapper
     template <typename Record, typename... InputParameters>
     std::vector<Record> Query(std::string_view sqlQueryString, InputParameters&&... inputParameters);
 
+    /// Queries multiple records from the database, based on the given query,
+    /// and eagerly loads the given relations of all of them.
+    ///
+    /// @see Include
+    template <typename Record, auto... Relations, typename... InputParameters>
+    std::vector<Record> Query(Include<Relations...> include,
+                              SqlSelectQueryBuilder::ComposedQuery const& selectQuery,
+                              InputParameters&&... inputParameters);
+
+    /// @brief Queries records lazily, fetching them one by one while iterating the returned range.
+    ///
+    /// Unlike Query(), this does not materialize the result set, and can be combined with range adaptors.
+    ///
+    /// @see RecordStream
+    template <typename Record, typename... InputParameters>
+    RecordStream<Record> Stream(SqlSelectQueryBuilder::ComposedQuery const& selectQuery,
+                                InputParameters&&... inputParameters);
+
+    /// @brief Queries records lazily, fetching them one by one while iterating the returned range.
+    ///
+    /// @see RecordStream
+    template <typename Record, typename... InputParameters>
+    RecordStream<Record> Stream(std::string_view sqlQueryString, InputParameters&&... inputParameters);
+
     /// Checks if the record has any modified fields.
     template <typename Record>
     bool IsModified(Record const& record) const noexcept;
@@ -176,10 +418,31 @@ class DataMapper
     template <typename Record>
     void Update(Record& record);
 
+    /// @brief Updates the modified fields of the given records in the database, all in one go.
+    ///
+    /// The records are grouped by the set of their modified fields. Each group is updated
+    /// by a single execution of its UPDATE statement with array-bound parameters.
+    /// Records without modified fields are skipped.
+    ///
+    /// All updates run in one transaction, unless a transaction is already active on the connection.
+    ///
+    /// @throws std::invalid_argument if the primary key of any record is modified, before anything is updated.
+    template <typename Record>
+    void UpdateAll(std::span<Record> records);
+
     /// Deletes the record from the database.
     template <typename Record>
     std::size_t Delete(Record const& record);
 
+    /// @brief Deletes the given records, or the records with the given primary keys, from the database.
+    ///
+    /// The records are deleted with `DELETE ... WHERE pk IN (...)` statements of up to InListChunkSize keys each.
+    /// The record type must have a single primary key.
+    ///
+    /// @return The total number of deleted rows.
+    template <typename Record, std::ranges::input_range RecordsOrKeys>
+    std::size_t DeleteAll(RecordsOrKeys const& recordsOrKeys);
+
     /// Counts the total number of records in the database for the given record type.
     template <typename Record>
     std::size_t Count();
@@ -188,6 +451,12 @@ class DataMapper
     template <typename Record>
     std::vector<Record> All();
 
+    /// Loads all records from the database for the given record type, and eagerly loads the given relations.
+    ///
+    /// @see Include
+    template <typename Record, auto... Relations>
+    std::vector<Record> All(Include<Relations...> include);
+
     /// Constructs an SQL query builder for the given record type.
     template <typename Record>
     auto Query() -> SqlQueryBuilder
@@ -209,6 +478,15 @@ class DataMapper
     template <typename Record>
     void LoadRelations(Record& record);
 
+    /// @brief Loads the given relations of all given records at once.
+    ///
+    /// Each relation is given as member pointer to a HasMany or BelongsTo member of the record.
+    /// The related records are queried with `WHERE key IN (...)`, in chunks of InListChunkSize keys,
+    /// and then distributed to the records they belong to.
+    template <auto... Relations, typename Record>
+        requires(sizeof...(Relations) > 0)
+    void LoadRelations(std::span<Record> records);
+
     /// Returns the first primary key field of the record.
     template <typename Record>
     decltype(auto) GetPrimaryKeyField(Record const& record) const;
@@ -224,12 +502,45 @@ class DataMapper
     template <typename Record, typename ValueType>
     void SetId(Record& record, ValueType&& id);
 
+    // Assigns the auto-assigned primary keys that are not set yet, querying the current maximum only once.
+    template <typename Record, typename Records>
+    void AssignPrimaryKeys(Records&& records);
+
+    // Executes the UPDATE statement of the record's modified fields, leaving its modified state untouched.
+    template <typename Record>
+    void ExecuteUpdate(Record const& record);
+
+    // Copies the values of the inserted columns of the given records into per-column parameter arrays.
+    template <typename Record>
+    static auto CollectInsertColumns(std::span<Record const> records);
+
+    // Inserts the given records with their keys generated by the server, retrieving them from the INSERT itself.
+    template <typename Record>
+    void InsertAllReturningKeys(std::span<Record> records);
+
     template <typename Record>
     void BindOutputColumns(Record& record);
 
     template <typename Record>
     void BindOutputColumns(Record& record, SqlStatement* stmt);
 
+    template <typename Record>
+    std::vector<Record> FetchRecords();
+
+    // Queries the record with the given primary key as shared instance, consulting the identity map if enabled.
+    template <typename Record, typename Key>
+    std::shared_ptr<Record> QueryShared(Key const& key);
+
+    // Removes the given record from the identity map.
+    template <typename Record>
+    void ForgetIdentity(Record const& record);
+
+    template <typename Record>
+    void FetchRecordsRowWise(std::vector<Record>& result);
+
+    template <typename Record>
+    void FetchRecordsColumnWise(std::vector<Record>& result);
+
     template <size_t FieldIndex, auto ReferencedRecordField, typename Record>
     void LoadBelongsTo(Record& record, BelongsTo<ReferencedRecordField>& field);
 
@@ -245,11 +556,28 @@ class DataMapper
     template <size_t FieldIndex, typename Record, typename OtherRecord, typename Callable>
     void CallOnHasMany(Record& record, Callable const& callback);
 
+    template <auto Relation, typename Record>
+    void IncludeRelation(std::span<Record> records);
+
+    template <typename Record, size_t ColumnIndex, typename Key, typename Callback>
+    void QueryWhereIn(std::vector<Key> const& keys, Callback const& callback);
+
     template <typename ReferencedRecord, typename ThroughRecord, typename Record, typename Callable>
     void CallOnHasManyThrough(Record& record, Callable const& callback);
 
+    // Number of records fetched per driver call when bulk fetching records.
+    static constexpr std::size_t BulkFetchRowCount = 1024;
+
+  public:
+    /// Maximum number of keys per `IN (...)` list when eagerly loading relations or deleting records,
+    /// staying well below the parameter limits of the supported databases.
+    static constexpr std::size_t InListChunkSize = 500;
+
+  private:
     SqlConnection _connection;
     SqlStatement _stmt;
+    IdentityMap _identityMap;
+    bool _identityMapEnabled = false;
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -392,6 +720,16 @@ void DataMapper::CreateTables()
     (CreateTable<MoreRecords>(), ...);
 }
 
+// Represents the number of primary key fields of a record.
+template <typename T>
+constexpr size_t RecordPrimaryKeyCount =
+    Reflection::FoldMembers<T>(size_t { 0 }, []<size_t I, typename Field>(size_t const accum) {
+        if constexpr (FieldWithStorage<Field> && Field::IsPrimaryKey)
+            return accum + 1;
+        else
+            return accum;
+    });
+
 template <typename T>
 constexpr bool HasAutoIncrementPrimaryKey =
     Reflection::FoldMembers<T>(false, []<size_t I, typename Field>(bool const accum) {
@@ -401,19 +739,362 @@ constexpr bool HasAutoIncrementPrimaryKey =
             return accum;
     });
 
+namespace detail
+{
+
+// Describes how the result rows of a query can be fetched into records.
+enum class RecordFetchMode : uint8_t
+{
+    RowByRow,   // Some column requires per-row post-processing (e.g. strings), fetch one row at a time.
+    ColumnWise, // All columns are fixed-size, fetch blocks of rows into per-column staging arrays.
+    RowWise,    // All columns are fixed-size and not nullable, fetch blocks of rows directly into the records.
+};
+
+// Tests if the given record member is bound to a result column (see DataMapper::BindOutputColumns).
+template <typename FieldType>
+constexpr bool IsBoundColumn = IsField<FieldType> || SqlOutputColumnBinder<FieldType>;
+
+template <typename FieldType>
+constexpr RecordFetchMode MemberFetchMode() noexcept
+{
+    if constexpr (!IsBoundColumn<FieldType>)
+        return RecordFetchMode::RowWise;
+    else if constexpr (!IsField<FieldType> && !::IsBelongsTo<FieldType>)
+        return RecordFetchMode::RowByRow;
+    else if constexpr (SqlBlockFetchValue<typename FieldType::ValueType>)
+        return RecordFetchMode::RowWise;
+    else if constexpr (IsStdOptional<typename FieldType::ValueType>)
+    {
+        if constexpr (SqlBlockFetchValue<typename FieldType::ValueType::value_type>)
+            return RecordFetchMode::ColumnWise;
+        else
+            return RecordFetchMode::RowByRow;
+    }
+    else
+        return RecordFetchMode::RowByRow;
+}
+
+// Represents the number of result columns bound to a record.
+template <typename Record>
+constexpr size_t RecordBoundColumnCount =
+    Reflection::FoldMembers<Record>(size_t { 0 }, []<size_t I, typename FieldType>(size_t const accum) constexpr {
+        if constexpr (IsBoundColumn<FieldType>)
+            return accum + 1;
+        else
+            return accum;
+    });
+
+// Represents the result column (starting at 0) the record member at the given index is bound to.
+template <typename Record, size_t MemberIndex>
+constexpr size_t RecordBoundColumnIndex =
+    Reflection::FoldMembers<Record>(size_t { 0 }, []<size_t I, typename FieldType>(size_t const accum) constexpr {
+        if constexpr (I < MemberIndex && IsBoundColumn<FieldType>)
+            return accum + 1;
+        else
+            return accum;
+    });
+
 template <typename Record>
-RecordId DataMapper::CreateExplicit(Record const& record)
+constexpr RecordFetchMode RecordFetchModeOf = []() constexpr {
+    if constexpr (RecordBoundColumnCount<Record> == 0)
+        return RecordFetchMode::RowByRow;
+    else
+    {
+        auto const mode = Reflection::FoldMembers<Record>(
+            RecordFetchMode::RowWise, []<size_t I, typename FieldType>(RecordFetchMode const accum) constexpr {
+                return std::min(accum, MemberFetchMode<FieldType>());
+            });
+        // Row-wise binding also requires the column indicators to fit into the record's stride.
+        if (mode == RecordFetchMode::RowWise
+            && !SqlStatement::CanFetchRowsInto<Record>(RecordBoundColumnCount<Record>))
+            return RecordFetchMode::ColumnWise;
+        return mode;
+    }
+}();
+
+// Staging array for the values of a bound record member, used for column-wise fetching.
+template <typename FieldType>
+struct ColumnStagingOf
 {
-    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+    using type = std::tuple<>;
+};
+
+template <typename FieldType>
+    requires(IsBoundColumn<FieldType> && !IsStdOptional<typename FieldType::ValueType>)
+struct ColumnStagingOf<FieldType>
+{
+    using type = std::tuple<std::vector<typename FieldType::ValueType>>;
+};
 
-    auto query = _connection.Query(RecordTableName<Record>).Insert(nullptr);
+template <typename FieldType>
+    requires(IsBoundColumn<FieldType> && IsStdOptional<typename FieldType::ValueType>)
+struct ColumnStagingOf<FieldType>
+{
+    using type = std::tuple<std::vector<typename FieldType::ValueType::value_type>>;
+};
+
+template <typename Record, size_t... I>
+auto MakeRecordColumnStaging(std::index_sequence<I...> /*indices*/)
+    -> decltype(std::tuple_cat(std::declval<typename ColumnStagingOf<Reflection::MemberTypeOf<I, Record>>::type>()...));
+
+// Tuple of staging arrays, one for each result column bound to the record.
+template <typename Record>
+using RecordColumnStaging =
+    decltype(MakeRecordColumnStaging<Record>(std::make_index_sequence<Reflection::CountMembers<Record>> {}));
+
+// Tests if the record member at the given index is bound as input parameter when inserting the record.
+template <typename FieldType>
+constexpr bool IsInsertedColumn = FieldWithStorage<FieldType> && !IsAutoIncrementPrimaryKey<FieldType>;
+
+// Represents the input parameter (starting at 0) the record member at the given index is bound to on insert.
+template <typename Record, size_t MemberIndex>
+constexpr size_t RecordInsertColumnIndex =
+    Reflection::FoldMembers<Record>(size_t { 0 }, []<size_t I, typename FieldType>(size_t const accum) constexpr {
+        if constexpr (I < MemberIndex && IsInsertedColumn<FieldType>)
+            return accum + 1;
+        else
+            return accum;
+    });
 
-    Reflection::EnumerateMembers(record, [&query]<auto I, typename FieldType>(FieldType const& /*field*/) {
-        if constexpr (FieldWithStorage<FieldType> && !IsAutoIncrementPrimaryKey<FieldType>)
-            query.Set(FieldNameOf<I, Record>, SqlWildcard);
+// Tests if all inserted columns of a record are fixed-size native values,
+// such that the records themselves can be bound row-wise as input parameter arrays.
+template <typename Record>
+constexpr bool IsRowWiseInsertable =
+    Reflection::FoldMembers<Record>(true, []<size_t I, typename FieldType>(bool const accum) constexpr {
+        if constexpr (IsInsertedColumn<FieldType>)
+            return accum && SqlBlockFetchValue<typename FieldType::ValueType>;
+        else
+            return accum;
     });
 
-    _stmt.Prepare(query);
+// Input parameter array for the values of an inserted record member, used for column-wise batch inserts.
+template <typename FieldType>
+struct InsertColumnOf
+{
+    using type = std::tuple<>;
+};
+
+template <typename FieldType>
+    requires(IsInsertedColumn<FieldType>)
+struct InsertColumnOf<FieldType>
+{
+    using type = std::tuple<std::vector<typename FieldType::ValueType>>;
+};
+
+template <typename Record, size_t... I>
+auto MakeRecordInsertColumns(std::index_sequence<I...> /*indices*/)
+    -> decltype(std::tuple_cat(std::declval<typename InsertColumnOf<Reflection::MemberTypeOf<I, Record>>::type>()...));
+
+// Tuple of input parameter arrays, one for each column inserted for a record.
+template <typename Record>
+using RecordInsertColumns =
+    decltype(MakeRecordInsertColumns<Record>(std::make_index_sequence<Reflection::CountMembers<Record>> {}));
+
+// Retrieves the column names of the columns inserted for a record, in the order of RecordInsertColumns.
+template <typename Record>
+auto const& RecordInsertColumnNames()
+{
+    static auto const columnNames = [] {
+        auto names = std::array<std::string_view, std::tuple_size_v<RecordInsertColumns<Record>>> {};
+        Reflection::EnumerateMembers<Record>([&]<size_t I, typename FieldType>() {
+            if constexpr (IsInsertedColumn<FieldType>)
+                names[RecordInsertColumnIndex<Record, I>] = FieldNameOf<I, Record>;
+        });
+        return names;
+    }();
+    return columnNames;
+}
+
+// Tests if the server can return the keys generated by a (multi-row) INSERT from the INSERT itself.
+inline bool SupportsInsertReturning(SqlConnection const& connection)
+{
+    switch (connection.ServerType())
+    {
+        case SqlServerType::MICROSOFT_SQL:
+        case SqlServerType::POSTGRESQL:
+            return true;
+        case SqlServerType::SQLITE: {
+            // RETURNING is supported since SQLite 3.35.
+            auto const version = connection.ServerVersion();
+            auto const* const end = version.data() + version.size();
+            auto major = 0U;
+            auto minor = 0U;
+            auto const [next, ec] = std::from_chars(version.data(), end, major);
+            if (ec == std::errc {} && next != end && *next == '.')
+                std::from_chars(next + 1, end, minor);
+            return std::pair { major, minor } >= std::pair { 3U, 35U };
+        }
+        case SqlServerType::ORACLE:
+        case SqlServerType::MYSQL:
+        case SqlServerType::UNKNOWN:
+            break;
+    }
+    return false;
+}
+
+// Represents the index (starting at 0) of the record member at the given index among the fields with storage.
+template <typename Record, size_t MemberIndex>
+constexpr size_t RecordStorageFieldIndex =
+    Reflection::FoldMembers<Record>(size_t { 0 }, []<size_t I, typename FieldType>(size_t const accum) constexpr {
+        if constexpr (I < MemberIndex && FieldWithStorage<FieldType>)
+            return accum + 1;
+        else
+            return accum;
+    });
+
+// Input parameter array for the values of a record member with storage, used for batch updates.
+template <typename FieldType>
+struct StorageColumnOf
+{
+    using type = std::tuple<>;
+};
+
+template <typename FieldType>
+    requires(FieldWithStorage<FieldType>)
+struct StorageColumnOf<FieldType>
+{
+    using type = std::tuple<std::vector<typename FieldType::ValueType>>;
+};
+
+template <typename Record, size_t... I>
+auto MakeRecordStorageColumns(std::index_sequence<I...> /*indices*/)
+    -> decltype(std::tuple_cat(std::declval<typename StorageColumnOf<Reflection::MemberTypeOf<I, Record>>::type>()...));
+
+// Tuple of input parameter arrays, one for each field with storage of a record.
+template <typename Record>
+using RecordStorageColumns =
+    decltype(MakeRecordStorageColumns<Record>(std::make_index_sequence<Reflection::CountMembers<Record>> {}));
+
+// Tests if all fields with storage of a record can be bound as input parameter arrays.
+template <typename Record>
+constexpr bool IsBatchUpdatable = []<typename... Columns>(std::type_identity<std::tuple<Columns...>> /*columns*/) {
+    return SqlNativeBatchable<Columns...>;
+}(std::type_identity<RecordStorageColumns<Record>> {});
+
+// Tests if the record has an auto-assigned primary key that is not set yet, i.e. it has not been created yet.
+template <typename Record>
+bool HasUnsetPrimaryKey(Record const& record)
+{
+    auto unset = false;
+    Reflection::EnumerateMembers(record, [&]<size_t I, typename FieldType>(FieldType const& field) {
+        if constexpr (IsField<FieldType>)
+            if constexpr (FieldType::IsAutoAssignPrimaryKey)
+                unset = unset || (!field.IsModified() && field.Value() == typename FieldType::ValueType {});
+    });
+    return unset;
+}
+
+// Constructs the parenthesized list of `count` parameter placeholders for a `WHERE column IN (...)` condition.
+inline RawSqlCondition InListPlaceholders(size_t count)
+{
+    auto placeholders = std::string { "(" };
+    for (auto const i: std::views::iota(size_t { 0 }, count))
+        placeholders += i == 0 ? "?" : ", ?";
+    placeholders += ')';
+    return RawSqlCondition { std::move(placeholders) };
+}
+
+} // namespace detail
+
+/// @brief Pre-built CRUD SQL statements for a given record type and SQL dialect.
+///
+/// @see RecordStatementsOf
+/// @ingroup DataMapper
+struct SqlRecordStatements
+{
+    /// INSERT of all storage fields, except an auto-increment primary key.
+    std::string insertAll;
+
+    /// SELECT of the first record with all storage fields, filtered by primary key.
+    std::string selectByPrimaryKey;
+
+    /// DELETE filtered by primary key.
+    std::string deleteByPrimaryKey;
+
+    /// SELECT of all records with all storage fields.
+    std::string selectAll;
+
+    /// INSERT of all storage fields, or UPDATE of all non-primary key fields if the primary key already exists.
+    std::string upsert;
+};
+
+namespace detail
+{
+
+template <typename Record>
+SqlRecordStatements BuildRecordStatements(SqlQueryFormatter const& formatter)
+{
+    auto const tableName = std::string(RecordTableName<Record>);
+
+    auto insertQuery = SqlQueryBuilder(formatter, tableName).Insert();
+    auto selectAllQuery = SqlQueryBuilder(formatter, tableName).Select();
+    auto selectByPrimaryKeyQuery = SqlQueryBuilder(formatter, tableName).Select();
+    auto deleteQuery = SqlQueryBuilder(formatter, tableName).Delete();
+    auto upsertQuery = SqlQueryBuilder(formatter, tableName).Upsert();
+
+    Reflection::EnumerateMembers<Record>([&]<size_t I, typename FieldType>() {
+        if constexpr (FieldWithStorage<FieldType>)
+        {
+            if constexpr (!IsAutoIncrementPrimaryKey<FieldType>)
+                insertQuery.Set(FieldNameOf<I, Record>, SqlWildcard);
+
+            selectAllQuery.Field(FieldNameOf<I, Record>);
+            selectByPrimaryKeyQuery.Field(FieldNameOf<I, Record>);
+
+            if constexpr (FieldType::IsPrimaryKey)
+                upsertQuery.Key(FieldNameOf<I, Record>, SqlWildcard);
+            else
+                upsertQuery.Set(FieldNameOf<I, Record>, SqlWildcard);
+
+            if constexpr (FieldType::IsPrimaryKey)
+            {
+                std::ignore = selectByPrimaryKeyQuery.Where(FieldNameOf<I, Record>, SqlWildcard);
+                std::ignore = deleteQuery.Where(FieldNameOf<I, Record>, SqlWildcard);
+            }
+        }
+    });
+
+    return SqlRecordStatements {
+        .insertAll = insertQuery.ToSql(),
+        .selectByPrimaryKey = selectByPrimaryKeyQuery.First().ToSql(),
+        .deleteByPrimaryKey = deleteQuery.ToSql(),
+        .selectAll = selectAllQuery.All().ToSql(),
+        .upsert = upsertQuery.ToSql(),
+    };
+}
+
+} // namespace detail
+
+/// @brief Retrieves the CRUD SQL statements for the given record type and server type.
+///
+/// The statements are built once per record type for all supported SQL dialects,
+/// so that the hot CRUD paths in DataMapper do not need to build any SQL strings.
+///
+/// @ingroup DataMapper
+template <typename Record>
+SqlRecordStatements const& RecordStatementsOf(SqlServerType serverType)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    constexpr auto ServerTypeCount = std::to_underlying(SqlServerType::MYSQL) + 1;
+
+    static auto const statements = [] {
+        auto result = std::array<SqlRecordStatements, ServerTypeCount> {};
+        for (auto const index: std::views::iota(0, ServerTypeCount))
+            if (auto const* formatter = SqlQueryFormatter::Get(static_cast<SqlServerType>(index)); formatter)
+                result[index] = detail::BuildRecordStatements<Record>(*formatter);
+        return result;
+    }();
+
+    return statements[std::to_underlying(serverType)];
+}
+
+template <typename Record>
+RecordId DataMapper::CreateExplicit(Record const& record)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    _stmt.Prepare(RecordStatementsOf<Record>(_connection.ServerType()).insertAll);
 
     Reflection::CallOnMembers(record,
                               [this, i = SQLSMALLINT { 1 }]<typename Name, typename FieldType>(
@@ -464,10 +1145,204 @@ RecordId DataMapper::Create(Record& record)
     if constexpr (HasAutoIncrementPrimaryKey<Record>)
         SetId(record, id.value);
 
-    ClearModifiedState(record);
-    ConfigureRelationAutoLoading(record);
+    ClearModifiedState(record);
+    ConfigureRelationAutoLoading(record);
+
+    return id;
+}
+
+template <typename Record, typename Records>
+void DataMapper::AssignPrimaryKeys(Records&& records)
+{
+    CallOnPrimaryKey<Record>([&]<size_t PrimaryKeyIndex, typename PrimaryKeyType>() {
+        if constexpr (PrimaryKeyType::IsAutoAssignPrimaryKey)
+        {
+            using ValueType = typename PrimaryKeyType::ValueType;
+            auto nextId = std::optional<ValueType> {};
+            for (Record& record: records)
+            {
+                CallOnPrimaryKey(record, [&]<size_t, typename>(PrimaryKeyType& primaryKeyField) {
+                    if (primaryKeyField.IsModified())
+                        return;
+
+                    if constexpr (std::same_as<ValueType, SqlGuid>)
+                    {
+                        primaryKeyField = SqlGuid::Create();
+                    }
+                    else if constexpr (requires { ValueType {} + 1; })
+                    {
+                        if (!nextId)
+                            nextId = SqlStatement { _connection }
+                                         .ExecuteDirectScalar<ValueType>(
+                                             std::format(R"sql(SELECT MAX("{}") FROM "{}")sql",
+                                                         FieldNameOf<PrimaryKeyIndex, Record>,
+                                                         RecordTableName<Record>))
+                                         .value_or(ValueType {})
+                                     + 1;
+                        primaryKeyField = (*nextId)++;
+                    }
+                });
+            }
+        }
+    });
+}
+
+template <typename Record>
+void DataMapper::CreateAll(std::span<Record> records)
+{
+    static_assert(!std::is_const_v<Record>);
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    if (records.empty())
+        return;
+
+    if constexpr (HasAutoIncrementPrimaryKey<Record>)
+    {
+        // The generated keys must be returned by the INSERT itself, as keys derived after the fact
+        // (e.g. from the last insert ID) are not reliable for multiple rows.
+        // A multi-row VALUES list cannot express rows without any inserted column though.
+        constexpr auto InsertColumnCount = std::tuple_size_v<detail::RecordInsertColumns<Record>>;
+        if (InsertColumnCount == 0 || !detail::SupportsInsertReturning(_connection))
+        {
+            for (auto& record: records)
+                Create(record);
+            return;
+        }
+
+        InsertAllReturningKeys(records);
+    }
+    else
+    {
+        AssignPrimaryKeys<Record>(records);
+
+        _stmt.Prepare(RecordStatementsOf<Record>(_connection.ServerType()).insertAll);
+
+        if constexpr (detail::IsRowWiseInsertable<Record>)
+        {
+            _stmt.ExecuteBatchRowWise(std::span<Record const> { records }, [](Record const& row, auto const& bind) {
+                Reflection::EnumerateMembers(row, [&]<size_t I, typename FieldType>(FieldType const& field) {
+                    if constexpr (detail::IsInsertedColumn<FieldType>)
+                        bind(SQLUSMALLINT { detail::RecordInsertColumnIndex<Record, I> + 1 }, &field.Value());
+                });
+            });
+        }
+        else
+        {
+            auto const columns = CollectInsertColumns<Record>(records);
+            std::apply([this](auto const&... column) { _stmt.ExecuteBatch(column...); }, columns);
+        }
+    }
+
+    for (auto& record: records)
+    {
+        ClearModifiedState(record);
+        ConfigureRelationAutoLoading(record);
+    }
+}
+
+template <typename Record>
+auto DataMapper::CollectInsertColumns(std::span<Record const> records)
+{
+    auto columns = detail::RecordInsertColumns<Record> {};
+    std::apply([&](auto&... column) { (column.reserve(records.size()), ...); }, columns);
+
+    for (auto const& record: records)
+        Reflection::EnumerateMembers(record, [&]<size_t I, typename FieldType>(FieldType const& field) {
+            if constexpr (detail::IsInsertedColumn<FieldType>)
+                std::get<detail::RecordInsertColumnIndex<Record, I>>(columns).emplace_back(field.Value());
+        });
+
+    return columns;
+}
+
+template <typename Record>
+void DataMapper::InsertAllReturningKeys(std::span<Record> records)
+{
+    if constexpr (std::tuple_size_v<detail::RecordInsertColumns<Record>> > 0)
+    {
+        CallOnPrimaryKey<Record>([&]<size_t PrimaryKeyIndex, typename PrimaryKeyType>() {
+            auto const columns = CollectInsertColumns<Record>(records);
+            auto const keys = std::apply(
+                [&](auto const&... column) {
+                    return _stmt.ExecuteInsertRowsReturning<typename PrimaryKeyType::ValueType>(
+                        RecordTableName<Record>,
+                        FieldNameOf<PrimaryKeyIndex, Record>,
+                        detail::RecordInsertColumnNames<Record>(),
+                        column...);
+                },
+                columns);
+
+            for (auto&& [record, key]: std::views::zip(records, keys))
+                CallOnPrimaryKey(record, [&]<size_t, typename>(PrimaryKeyType& primaryKeyField) {
+                    primaryKeyField = key;
+                });
+        });
+    }
+}
+
+template <typename Record>
+void DataMapper::Save(Record& record)
+{
+    static_assert(!std::is_const_v<Record>);
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+    static_assert(!HasAutoIncrementPrimaryKey<Record>,
+                  "Save() requires a primary key that is not auto-incremented by the server");
+
+    if (detail::HasUnsetPrimaryKey(record))
+        AssignPrimaryKeys<Record>(std::span { &record, 1 });
+
+    _stmt.Prepare(RecordStatementsOf<Record>(_connection.ServerType()).upsert);
+
+    Reflection::CallOnMembers(record,
+                              [this, i = SQLSMALLINT { 1 }]<typename Name, typename FieldType>(
+                                  Name const& name, FieldType const& field) mutable {
+                                  if constexpr (FieldWithStorage<FieldType>)
+                                      _stmt.BindInputParameter(i++, field.Value(), name);
+                              });
+
+    _stmt.Execute();
+
+    ClearModifiedState(record);
+    ForgetIdentity(record);
+    ConfigureRelationAutoLoading(record);
+}
+
+template <typename Record>
+void DataMapper::SaveAll(std::span<Record> records)
+{
+    static_assert(!std::is_const_v<Record>);
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+    static_assert(!HasAutoIncrementPrimaryKey<Record>,
+                  "SaveAll() requires a primary key that is not auto-incremented by the server");
+
+    if (records.empty())
+        return;
+
+    auto newRecords = std::vector<std::reference_wrapper<Record>> {};
+    for (auto& record: records)
+        if (detail::HasUnsetPrimaryKey(record))
+            newRecords.emplace_back(record);
+    AssignPrimaryKeys<Record>(newRecords);
+
+    _stmt.Prepare(RecordStatementsOf<Record>(_connection.ServerType()).upsert);
+
+    auto columns = detail::RecordStorageColumns<Record> {};
+    std::apply([&](auto&... column) { (column.reserve(records.size()), ...); }, columns);
+
+    for (auto const& record: records)
+        Reflection::EnumerateMembers(record, [&]<size_t I, typename FieldType>(FieldType const& field) {
+            if constexpr (FieldWithStorage<FieldType>)
+                std::get<detail::RecordStorageFieldIndex<Record, I>>(columns).emplace_back(field.Value());
+        });
+
+    std::apply([this](auto const&... column) { _stmt.ExecuteBatch(column...); }, columns);
 
-    return id;
+    for (auto& record: records)
+    {
+        ClearModifiedState(record);
+        ForgetIdentity(record);
+        ConfigureRelationAutoLoading(record);
+    }
 }
 
 template <typename Record>
@@ -492,6 +1367,16 @@ void DataMapper::Update(Record& record)
 {
     static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
 
+    ExecuteUpdate(record);
+
+    // Evict before clearing the modified state, which tells whether the primary key has changed.
+    ForgetIdentity(record);
+    ClearModifiedState(record);
+}
+
+template <typename Record>
+void DataMapper::ExecuteUpdate(Record const& record)
+{
     auto query = _connection.Query(RecordTableName<Record>).Update();
 
     Reflection::CallOnMembers(record,
@@ -522,24 +1407,116 @@ void DataMapper::Update(Record& record)
         });
 
     _stmt.Execute();
-
-    ClearModifiedState(record);
 }
 
 template <typename Record>
-std::size_t DataMapper::Delete(Record const& record)
+void DataMapper::UpdateAll(std::span<Record> records)
 {
+    static_assert(!std::is_const_v<Record>);
     static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
 
-    auto query = _connection.Query(RecordTableName<Record>).Delete();
-
-    Reflection::CallOnMembers(
-        record, [&query]<typename Name, typename FieldType>(Name const& name, FieldType const& /*field*/) {
-            if constexpr (FieldType::IsPrimaryKey)
-                std::ignore = query.Where(name, SqlWildcard);
+    // Groups the records by their modified fields, such that each group shares the same UPDATE statement.
+    using Signature = std::array<bool, RecordStorageFieldCount<Record>>;
+    auto groups = std::map<Signature, std::vector<Record*>> {};
+    for (auto& record: records)
+    {
+        auto signature = Signature {};
+        Reflection::EnumerateMembers(record, [&]<size_t I, typename FieldType>(FieldType const& field) {
+            if constexpr (FieldWithStorage<FieldType>)
+            {
+                // The rows are matched by their primary key, whose originally loaded value is unknown once modified.
+                if constexpr (FieldType::IsPrimaryKey)
+                    if (field.IsModified())
+                        throw std::invalid_argument(std::format("UpdateAll() cannot modify the primary key {}.{}",
+                                                                RecordTableName<Record>,
+                                                                FieldNameOf<I, Record>));
+                signature[detail::RecordStorageFieldIndex<Record, I>] = field.IsModified();
+            }
         });
+        if (std::ranges::any_of(signature, std::identity {}))
+            groups[signature].push_back(&record);
+    }
 
-    _stmt.Prepare(query);
+    if (groups.empty())
+        return;
+
+    auto transaction = std::optional<SqlTransaction> {};
+    if (!_connection.TransactionActive())
+        transaction.emplace(_connection, SqlTransactionMode::ROLLBACK);
+
+    for (auto const& [signature, group]: groups)
+    {
+        if constexpr (detail::IsBatchUpdatable<Record>)
+        {
+            // Same statement as Update() builds: modified fields are SET, the primary keys are matched.
+            auto query = _connection.Query(RecordTableName<Record>).Update();
+            auto parameterPositions = std::array<SQLUSMALLINT, RecordStorageFieldCount<Record>> {};
+            auto parameterCount = SQLUSMALLINT { 0 };
+
+            Reflection::EnumerateMembers<Record>([&]<size_t I, typename FieldType>() {
+                if constexpr (FieldWithStorage<FieldType>)
+                {
+                    constexpr auto Index = detail::RecordStorageFieldIndex<Record, I>;
+                    if (signature[Index])
+                    {
+                        query.Set(FieldNameOf<I, Record>, SqlWildcard);
+                        parameterPositions[Index] = ++parameterCount;
+                    }
+                }
+            });
+
+            Reflection::EnumerateMembers<Record>([&]<size_t I, typename FieldType>() {
+                if constexpr (FieldWithStorage<FieldType> && FieldType::IsPrimaryKey)
+                {
+                    std::ignore = query.Where(FieldNameOf<I, Record>, SqlWildcard);
+                    parameterPositions[detail::RecordStorageFieldIndex<Record, I>] = ++parameterCount;
+                }
+            });
+
+            _stmt.Prepare(query);
+
+            // Only the columns bound by this group's statement are filled, the others stay empty.
+            auto columns = detail::RecordStorageColumns<Record> {};
+            for (auto const* record: group)
+                Reflection::EnumerateMembers(*record, [&]<size_t I, typename FieldType>(FieldType const& field) {
+                    if constexpr (FieldWithStorage<FieldType>)
+                    {
+                        constexpr auto Index = detail::RecordStorageFieldIndex<Record, I>;
+                        if (parameterPositions[Index])
+                            std::get<Index>(columns).emplace_back(field.Value());
+                    }
+                });
+
+            std::apply([&](auto const&... column) { _stmt.ExecuteBatchNativeMapped(parameterPositions, column...); },
+                       columns);
+        }
+        else
+        {
+            // Not all columns can be bound as parameter arrays, so fall back to updating record by record.
+            for (auto const* record: group)
+                ExecuteUpdate(*record);
+        }
+    }
+
+    if (transaction)
+        transaction->Commit();
+
+    // Only now that the updates are committed (or left to the outer transaction), the records are in sync
+    // with the database. Had any group failed, all records would have kept their modified state for a retry.
+    for (auto const& group: groups | std::views::values)
+        for (auto* record: group)
+        {
+            ForgetIdentity(*record);
+            ClearModifiedState(*record);
+        }
+}
+
+template <typename Record>
+std::size_t DataMapper::Delete(Record const& record)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    _stmt.Prepare(RecordStatementsOf<Record>(_connection.ServerType()).deleteByPrimaryKey);
 
     // Bind the WHERE clause
     Reflection::CallOnMembers(record,
@@ -550,28 +1527,94 @@ std::size_t DataMapper::Delete(Record const& record)
                               });
 
     _stmt.Execute();
+    ForgetIdentity(record);
 
     return _stmt.NumRowsAffected();
 }
 
-template <typename Record, typename... PrimaryKeyTypes>
-std::optional<Record> DataMapper::QuerySingle(PrimaryKeyTypes&&... primaryKeys)
+template <typename Record, std::ranges::input_range RecordsOrKeys>
+std::size_t DataMapper::DeleteAll(RecordsOrKeys const& recordsOrKeys)
 {
     static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+    static_assert(RecordPrimaryKeyCount<Record> == 1, "DeleteAll() requires a record with a single primary key");
 
-    auto queryBuilder = _connection.Query(RecordTableName<Record>).Select();
+    using Element = std::ranges::range_value_t<RecordsOrKeys>;
 
-    Reflection::EnumerateMembers<Record>([&]<size_t I, typename FieldType>() {
-        if constexpr (FieldWithStorage<FieldType>)
+    auto numRowsAffected = std::size_t { 0 };
+
+    CallOnPrimaryKey<Record>([&]<size_t PrimaryKeyIndex, typename PrimaryKeyType>() {
+        using Key = typename PrimaryKeyType::ValueType;
+
+        auto keys = std::vector<Key> {};
+        if constexpr (std::ranges::sized_range<RecordsOrKeys>)
+            keys.reserve(std::ranges::size(recordsOrKeys));
+
+        for (auto const& element: recordsOrKeys)
         {
-            queryBuilder.Field(FieldNameOf<I, Record>);
+            if constexpr (std::same_as<Element, Record>)
+                Reflection::EnumerateMembers(element, [&]<size_t I, typename FieldType>(FieldType const& field) {
+                    if constexpr (I == PrimaryKeyIndex)
+                        keys.push_back(field.Value());
+                });
+            else if constexpr (IsField<Element>)
+                keys.emplace_back(element.Value());
+            else
+                keys.emplace_back(element);
+        }
 
-            if constexpr (FieldType::IsPrimaryKey)
-                std::ignore = queryBuilder.Where(FieldNameOf<I, Record>, SqlWildcard);
+        for (auto const chunk: keys | std::views::chunk(InListChunkSize))
+        {
+            auto const sqlQueryString =
+                _connection.Query(RecordTableName<Record>)
+                    .Delete()
+                    .Where(FieldNameOf<PrimaryKeyIndex, Record>,
+                           "IN",
+                           detail::InListPlaceholders(std::ranges::size(chunk)))
+                    .ToSql();
+
+            _stmt.Prepare(sqlQueryString);
+            for (auto&& [i, key]: chunk | std::views::enumerate)
+                _stmt.BindInputParameter(static_cast<SQLSMALLINT>(i + 1), key, FieldNameOf<PrimaryKeyIndex, Record>);
+            _stmt.Execute();
+
+            numRowsAffected += _stmt.NumRowsAffected();
         }
+
+        if (_identityMapEnabled)
+            for (auto const& key: keys)
+                _identityMap.Erase<Record>(key);
     });
 
-    _stmt.Prepare(queryBuilder.First());
+    return numRowsAffected;
+}
+
+template <typename Record, typename... PrimaryKeyTypes>
+std::optional<Record> DataMapper::QuerySingle(PrimaryKeyTypes&&... primaryKeys)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    if constexpr (sizeof...(PrimaryKeyTypes) == 1)
+    {
+        if (_identityMapEnabled)
+        {
+            auto result = std::optional<Record> {};
+            CallOnPrimaryKey<Record>([&]<size_t PrimaryKeyIndex, typename PrimaryKeyType>() {
+                using Key = typename PrimaryKeyType::ValueType;
+                auto shared = std::shared_ptr<Record> {};
+                if constexpr ((IsField<PrimaryKeyTypes> && ...))
+                    shared = QueryShared<Record>(Key(primaryKeys.Value()...));
+                else
+                    shared = QueryShared<Record>(Key(std::forward<PrimaryKeyTypes>(primaryKeys)...));
+                if (shared)
+                    result.emplace(*shared);
+            });
+            if (result)
+                ConfigureRelationAutoLoading(*result);
+            return result;
+        }
+    }
+
+    _stmt.Prepare(RecordStatementsOf<Record>(_connection.ServerType()).selectByPrimaryKey);
     _stmt.Execute(std::forward<PrimaryKeyTypes>(primaryKeys)...);
 
     auto resultRecord = Record {};
@@ -631,20 +1674,166 @@ std::vector<Record> DataMapper::Query(std::string_view sqlQueryString, InputPara
     _stmt.Prepare(sqlQueryString);
     _stmt.Execute(std::forward<InputParameters>(inputParameters)...);
 
-    auto result = std::vector<Record> {};
+    return FetchRecords<Record>();
+}
 
-    auto record = Record {};
-    BindOutputColumns(record);
-    ConfigureRelationAutoLoading(record);
+template <typename Record, auto... Relations, typename... InputParameters>
+std::vector<Record> DataMapper::Query(Include<Relations...> /*include*/,
+                                      SqlSelectQueryBuilder::ComposedQuery const& selectQuery,
+                                      InputParameters&&... inputParameters)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    auto result = Query<Record>(selectQuery.ToSql(), std::forward<InputParameters>(inputParameters)...);
+    if constexpr (sizeof...(Relations) > 0)
+        LoadRelations<Relations...>(std::span { result });
+    return result;
+}
+
+template <typename Record>
+std::vector<Record> DataMapper::FetchRecords()
+{
+    auto result = std::vector<Record> {};
 
-    while (_stmt.FetchRow())
+    if constexpr (detail::RecordFetchModeOf<Record> == detail::RecordFetchMode::RowWise)
+        FetchRecordsRowWise(result);
+    else if constexpr (detail::RecordFetchModeOf<Record> == detail::RecordFetchMode::ColumnWise)
+        FetchRecordsColumnWise(result);
+    else
     {
-        result.emplace_back(std::move(record));
-        record = Record {};
+        // The columns stay bound to the same record, which is copied for each fetched row.
+        auto record = Record {};
         BindOutputColumns(record);
+
+        while (_stmt.FetchRow())
+            result.emplace_back(record);
+    }
+
+    // The relation auto loaders refer to their record by address, so configure them once the records are in place.
+    for (auto& record: result)
         ConfigureRelationAutoLoading(record);
+
+    return result;
+}
+
+template <typename Record, typename... InputParameters>
+inline LIGHTWEIGHT_FORCE_INLINE RecordStream<Record> DataMapper::Stream(
+    SqlSelectQueryBuilder::ComposedQuery const& selectQuery, InputParameters&&... inputParameters)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    return Stream<Record>(selectQuery.ToSql(), std::forward<InputParameters>(inputParameters)...);
+}
+
+template <typename Record, typename... InputParameters>
+RecordStream<Record> DataMapper::Stream(std::string_view sqlQueryString, InputParameters&&... inputParameters)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    auto stream = RecordStream<Record> { SqlStatement { _connection } };
+    auto& state = *stream._state;
+
+    state.stmt.Prepare(sqlQueryString);
+    state.stmt.Execute(std::forward<InputParameters>(inputParameters)...);
+
+    BindOutputColumns(state.record, &state.stmt);
+    ConfigureRelationAutoLoading(state.record);
+
+    return stream;
+}
+
+template <typename Record>
+void DataMapper::FetchRecordsRowWise(std::vector<Record>& result)
+{
+    static_assert(detail::RecordFetchModeOf<Record> == detail::RecordFetchMode::RowWise);
+
+    while (true)
+    {
+        // Let the driver write each block straight into the records, using sizeof(Record) as the row stride.
+        auto const offset = result.size();
+        result.resize(offset + BulkFetchRowCount);
+
+        auto const rows = std::span { result }.subspan(offset);
+        auto const fetchedRows =
+            _stmt.FetchRowsInto(rows, detail::RecordBoundColumnCount<Record>, [](Record& firstRow, auto const& bind) {
+                Reflection::EnumerateMembers(firstRow, [&]<size_t I, typename FieldType>(FieldType& field) {
+                    if constexpr (detail::IsBoundColumn<FieldType>)
+                        bind(SQLUSMALLINT { detail::RecordBoundColumnIndex<Record, I> + 1 }, &field.MutableValue());
+                });
+            });
+
+        // Mirrors SqlDataBinder<BelongsTo<>>::OutputColumn(), which marks fetched foreign keys as modified.
+        for (auto& record: rows.first(fetchedRows))
+            Reflection::EnumerateMembers(record, []<size_t I, typename FieldType>(FieldType& field) {
+                if constexpr (IsBelongsTo<FieldType>)
+                    field.SetModified(true);
+            });
+
+        result.resize(offset + fetchedRows);
+
+        if (fetchedRows < BulkFetchRowCount)
+            break;
+    }
+}
+
+template <typename Record>
+void DataMapper::FetchRecordsColumnWise(std::vector<Record>& result)
+{
+    static_assert(detail::RecordFetchModeOf<Record> == detail::RecordFetchMode::ColumnWise);
+
+    auto staging = detail::RecordColumnStaging<Record> {};
+    std::apply([](auto&... columns) { (columns.resize(BulkFetchRowCount), ...); }, staging);
+
+    while (true)
+    {
+        auto const fetchedRows =
+            std::apply([this](auto&... columns) { return _stmt.FetchRows(columns...); }, staging);
+
+        auto const offset = result.size();
+        result.resize(offset + fetchedRows);
+
+        for (auto const row: std::views::iota(size_t { 0 }, fetchedRows))
+        {
+            Reflection::EnumerateMembers(
+                result[offset + row], [&]<size_t I, typename FieldType>(FieldType& field) {
+                    if constexpr (detail::IsBoundColumn<FieldType>)
+                    {
+                        constexpr auto ColumnIndex = detail::RecordBoundColumnIndex<Record, I>;
+                        auto const isNull = _stmt.IsNullInFetchedRows(SQLUSMALLINT { ColumnIndex + 1 }, row);
+                        // NULL values leave non-nullable fields default initialized, as with single row fetching.
+                        if constexpr (detail::IsStdOptional<typename FieldType::ValueType>)
+                            field.MutableValue() = isNull ? std::nullopt
+                                                          : std::optional { std::get<ColumnIndex>(staging)[row] };
+                        else if (!isNull)
+                            field.MutableValue() = std::get<ColumnIndex>(staging)[row];
+
+                        if constexpr (IsBelongsTo<FieldType>)
+                            field.SetModified(true);
+                    }
+                });
+        }
+
+        if (fetchedRows < BulkFetchRowCount)
+            break;
     }
+}
+
+template <typename Record>
+std::vector<Record> DataMapper::All()
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    return Query<Record>(RecordStatementsOf<Record>(_connection.ServerType()).selectAll);
+}
 
+template <typename Record, auto... Relations>
+std::vector<Record> DataMapper::All(Include<Relations...> /*include*/)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    auto result = All<Record>();
+    if constexpr (sizeof...(Relations) > 0)
+        LoadRelations<Relations...>(std::span { result });
     return result;
 }
 
@@ -715,13 +1904,56 @@ void DataMapper::LoadBelongsTo(Record& record, BelongsTo<ReferencedRecordField>&
     using FieldType = BelongsTo<ReferencedRecordField>;
     using ReferencedRecord = typename FieldType::ReferencedRecord;
 
-    CallOnPrimaryKey(record,
-                     [&]<size_t PrimaryKeyIndex, typename PrimaryKeyType>(PrimaryKeyType const& primaryKeyField) {
-                         if (auto result = QuerySingle<ReferencedRecord>(primaryKeyField.Value()); result)
-                         {
-                             field.EmplaceRecord() = std::move(*result);
-                         }
-                     });
+    if (auto shared = QueryShared<ReferencedRecord>(field.Value()); shared)
+        field.EmplaceRecord(std::move(shared), _identityMapEnabled);
+}
+
+template <typename Record, typename Key>
+std::shared_ptr<Record> DataMapper::QueryShared(Key const& key)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    if (_identityMapEnabled)
+        if (auto cached = _identityMap.Find<Record>(key); cached)
+            return cached;
+
+    _stmt.Prepare(RecordStatementsOf<Record>(_connection.ServerType()).selectByPrimaryKey);
+    _stmt.Execute(key);
+
+    auto shared = std::make_shared<Record>();
+    BindOutputColumns(*shared);
+
+    if (!_stmt.FetchRow())
+        return nullptr;
+
+    _stmt.CloseCursor();
+
+    ConfigureRelationAutoLoading(*shared);
+
+    if (_identityMapEnabled)
+        _identityMap.Put(key, shared);
+
+    return shared;
+}
+
+template <typename Record>
+void DataMapper::ForgetIdentity(Record const& record)
+{
+    if (!_identityMapEnabled)
+        return;
+
+    // A modified primary key no longer tells which entry the record has been loaded as,
+    // so all records of this type are evicted then.
+    Reflection::EnumerateMembers(record, [&]<size_t I, typename FieldType>(FieldType const& field) {
+        if constexpr (IsField<FieldType>)
+            if constexpr (FieldType::IsPrimaryKey)
+            {
+                if (field.IsModified())
+                    _identityMap.EraseAll<Record, typename FieldType::ValueType>();
+                else
+                    _identityMap.Erase<Record>(field.Value());
+            }
+    });
 }
 
 template <size_t FieldIndex, typename Record, typename OtherRecord, typename Callable>
@@ -911,6 +2143,145 @@ void DataMapper::LoadRelations(Record& record)
     });
 }
 
+template <auto... Relations, typename Record>
+    requires(sizeof...(Relations) > 0)
+void DataMapper::LoadRelations(std::span<Record> records)
+{
+    static_assert(!std::is_const_v<Record>);
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    if (records.empty())
+        return;
+
+    (IncludeRelation<Relations>(records), ...);
+}
+
+template <typename Record, size_t ColumnIndex, typename Key, typename Callback>
+void DataMapper::QueryWhereIn(std::vector<Key> const& keys, Callback const& callback)
+{
+    for (auto const chunk: keys | std::views::chunk(InListChunkSize))
+    {
+        auto const sqlQueryString =
+            _connection.Query(RecordTableName<Record>)
+                .Select()
+                .Build([&](auto& query) {
+                    Reflection::EnumerateMembers<Record>([&]<size_t FieldIndex, typename FieldType>() {
+                        if constexpr (FieldWithStorage<FieldType>)
+                            query.Field(FieldNameOf<FieldIndex, Record>);
+                    });
+                })
+                .Where(FieldNameOf<ColumnIndex, Record>, "IN", detail::InListPlaceholders(std::ranges::size(chunk)))
+                .All()
+                .ToSql();
+
+        _stmt.Prepare(sqlQueryString);
+        for (auto&& [i, key]: chunk | std::views::enumerate)
+            _stmt.BindInputParameter(static_cast<SQLSMALLINT>(i + 1), key, FieldNameOf<ColumnIndex, Record>);
+        _stmt.Execute();
+
+        callback(FetchRecords<Record>());
+    }
+}
+
+template <auto Relation, typename Record>
+void DataMapper::IncludeRelation(std::span<Record> records)
+{
+    static_assert(std::same_as<MemberClassType<decltype(Relation)>, Record>,
+                  "The relation must be a member of the queried record");
+
+    using FieldType = std::remove_cvref_t<decltype(std::declval<Record&>().*Relation)>;
+    using ReferencedRecord = typename FieldType::ReferencedRecord;
+
+    if constexpr (IsHasMany<FieldType>)
+    {
+        // The "many" side refers back to this record via its (only) BelongsTo member pointing to this record type.
+        CallOnPrimaryKey<Record>([&]<size_t PrimaryKeyIndex, typename PrimaryKeyType>() {
+            using Key = typename PrimaryKeyType::ValueType;
+            CallOnBelongsTo<ReferencedRecord>([&]<size_t ForeignKeyIndex, typename ForeignKeyType>() {
+                if constexpr (std::same_as<typename ForeignKeyType::ReferencedRecord, Record>)
+                {
+                    auto related = std::map<Key, typename FieldType::ReferencedRecordList> {};
+                    for (auto& record: records)
+                        CallOnPrimaryKey(record, [&]<size_t, typename>(PrimaryKeyType const& primaryKeyField) {
+                            related.try_emplace(primaryKeyField.Value());
+                        });
+
+                    auto keys = std::vector<Key> {};
+                    keys.reserve(related.size());
+                    for (auto const& key: related | std::views::keys)
+                        keys.push_back(key);
+
+                    QueryWhereIn<ReferencedRecord, ForeignKeyIndex>(keys, [&](std::vector<ReferencedRecord>&& fetched) {
+                        for (auto& referencedRecord: fetched)
+                        {
+                            auto shared = std::make_shared<ReferencedRecord>(std::move(referencedRecord));
+                            // The auto loaders refer to their record by address, which just changed.
+                            ConfigureRelationAutoLoading(*shared);
+                            Reflection::EnumerateMembers(
+                                *shared, [&]<size_t I, typename ReferencedFieldType>(ReferencedFieldType& field) {
+                                    if constexpr (I == ForeignKeyIndex)
+                                        related[field.Value()].emplace_back(std::move(shared));
+                                });
+                        }
+                    });
+
+                    for (auto& record: records)
+                        CallOnPrimaryKey(record, [&]<size_t, typename>(PrimaryKeyType const& primaryKeyField) {
+                            (record.*Relation).Emplace(std::move(related[primaryKeyField.Value()]));
+                        });
+                }
+            });
+        });
+    }
+    else if constexpr (IsBelongsTo<FieldType>)
+    {
+        CallOnPrimaryKey<ReferencedRecord>([&]<size_t PrimaryKeyIndex, typename PrimaryKeyType>() {
+            using Key = typename FieldType::ValueType;
+
+            auto related = std::map<Key, std::shared_ptr<ReferencedRecord>> {};
+            for (auto& record: records)
+                related.try_emplace((record.*Relation).Value());
+
+            auto keys = std::vector<Key> {};
+            keys.reserve(related.size());
+            for (auto& [key, referencedRecord]: related)
+            {
+                if (_identityMapEnabled)
+                    referencedRecord = _identityMap.Find<ReferencedRecord>(key);
+                if (!referencedRecord)
+                    keys.push_back(key);
+            }
+
+            QueryWhereIn<ReferencedRecord, PrimaryKeyIndex>(keys, [&](std::vector<ReferencedRecord>&& fetched) {
+                for (auto& referencedRecord: fetched)
+                {
+                    auto key = Key {};
+                    CallOnPrimaryKey(referencedRecord, [&]<size_t, typename>(PrimaryKeyType const& primaryKeyField) {
+                        key = primaryKeyField.Value();
+                    });
+                    auto& shared = related[key];
+                    shared = std::make_shared<ReferencedRecord>(std::move(referencedRecord));
+                    ConfigureRelationAutoLoading(*shared);
+                    if (_identityMapEnabled)
+                        _identityMap.Put(key, shared);
+                }
+            });
+
+            // All records referencing the same key share the same instance.
+            for (auto& record: records)
+            {
+                auto& belongsTo = record.*Relation;
+                if (auto const& referencedRecord = related[belongsTo.Value()]; referencedRecord)
+                    belongsTo.EmplaceRecord(referencedRecord, _identityMapEnabled);
+            }
+        });
+    }
+    else
+    {
+        static_assert(IsHasMany<FieldType> || IsBelongsTo<FieldType>, "Only HasMany and BelongsTo can be included");
+    }
+}
+
 template <typename Record>
 inline LIGHTWEIGHT_FORCE_INLINE decltype(auto) DataMapper::GetPrimaryKeyField(Record const& record) const
 {
@@ -951,25 +2322,35 @@ inline LIGHTWEIGHT_FORCE_INLINE void DataMapper::BindOutputColumns(Record& recor
     BindOutputColumns(record, &_stmt);
 }
 
+namespace detail
+{
+
+// Binds the fields of the record to the result columns of the statement, in the order of the record's members.
 template <typename Record>
-void DataMapper::BindOutputColumns(Record& record, SqlStatement* stmt)
+void BindRecordOutputColumns(Record& record, SqlStatement& stmt)
 {
-    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
     static_assert(!std::is_const_v<Record>);
-    assert(stmt != nullptr);
 
-    Reflection::EnumerateMembers(record, [stmt, i = SQLSMALLINT { 1 }]<size_t I, typename Field>(Field& field) mutable {
+    auto column = SQLSMALLINT { 1 };
+    Reflection::EnumerateMembers(record, [&]<size_t I, typename Field>(Field& field) {
         if constexpr (IsField<Field>)
-        {
-            stmt->BindOutputColumn(i++, &field.MutableValue());
-        }
+            stmt.BindOutputColumn(column++, &field.MutableValue());
         else if constexpr (SqlOutputColumnBinder<Field>)
-        {
-            stmt->BindOutputColumn(i++, &field);
-        }
+            stmt.BindOutputColumn(column++, &field);
     });
 }
 
+} // namespace detail
+
+template <typename Record>
+void DataMapper::BindOutputColumns(Record& record, SqlStatement* stmt)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+    assert(stmt != nullptr);
+
+    detail::BindRecordOutputColumns(record, *stmt);
+}
+
 template <typename Record>
 void DataMapper::ConfigureRelationAutoLoading(Record& record)
 {
@@ -1014,10 +2395,7 @@ void DataMapper::ConfigureRelationAutoLoading(Record& record)
                                 ConfigureRelationAutoLoading(referencedRecord);
 
                                 while (stmt.FetchRow())
-                                {
                                     each(referencedRecord);
-                                    BindOutputColumns(referencedRecord, &stmt);
-                                }
                             });
                     },
             });
@@ -1072,10 +2450,7 @@ void DataMapper::ConfigureRelationAutoLoading(Record& record)
                                 ConfigureRelationAutoLoading(referencedRecord);
 
                                 while (stmt.FetchRow())
-                                {
                                     each(referencedRecord);
-                                    BindOutputColumns(referencedRecord, &stmt);
-                                }
                             });
                     },
             });
@@ -61,6 +61,9 @@ class HasMany
     /// Emplaces the given list of records.
     ReferencedRecordList& Emplace(ReferencedRecordList&& records) noexcept;
 
+    /// Unloads the records from memory, so that they are loaded again on next access.
+    void Unload() noexcept;
+
     /// Retrieves the number of records in this 1-to-many relationship.
     [[nodiscard]] std::size_t Count() const noexcept;
 
@@ -146,6 +149,13 @@ inline LIGHTWEIGHT_FORCE_INLINE HasMany<OtherRecord>::ReferencedRecordList& HasM
     return *_records;
 }
 
+template <typename OtherRecord>
+inline LIGHTWEIGHT_FORCE_INLINE void HasMany<OtherRecord>::Unload() noexcept
+{
+    _records = std::nullopt;
+    _count = std::nullopt;
+}
+
 template <typename OtherRecord>
 inline LIGHTWEIGHT_FORCE_INLINE HasMany<OtherRecord>::ReferencedRecordList& HasMany<OtherRecord>::All() noexcept
 {
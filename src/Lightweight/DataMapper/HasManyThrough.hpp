@@ -43,6 +43,9 @@ class HasManyThrough
     /// Emplaces the given list of records into this relationship.
     ReferencedRecordList& Emplace(ReferencedRecordList&& records) noexcept;
 
+    /// Unloads the records from memory, so that they are loaded again on next access.
+    void Unload() noexcept;
+
     /// Retrieves the number of records in this relationship.
     [[nodiscard]] std::size_t Count() const;
 
@@ -174,6 +177,13 @@ HasManyThrough<ReferencedRecordT, ThroughRecordT>::ReferencedRecordList& HasMany
     return *_records;
 }
 
+template <typename ReferencedRecordT, typename ThroughRecordT>
+void HasManyThrough<ReferencedRecordT, ThroughRecordT>::Unload() noexcept
+{
+    _records = std::nullopt;
+    _count = std::nullopt;
+}
+
 template <typename ReferencedRecordT, typename ThroughRecordT>
 std::size_t HasManyThrough<ReferencedRecordT, ThroughRecordT>::Count() const
 {
@@ -41,7 +41,7 @@ class HasOneThrough
     [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE constexpr bool IsLoaded() const noexcept { return _record.get() != nullptr; }
 
     /// Unloads the record from memory.
-    LIGHTWEIGHT_FORCE_INLINE void Unload() noexcept { _record = std::nullopt; }
+    LIGHTWEIGHT_FORCE_INLINE void Unload() noexcept { _record.reset(); }
 
     /// @brief Retrieves the record in this relationship.
     /// @note On-demand loads the record if it is not already loaded.
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+
+/// @brief First-level cache of loaded records, keyed by record type and primary key.
+///
+/// Holds at most one in-memory instance per database row, so that a record referenced by many others
+/// (e.g. the parent of many BelongsTo relations) is queried and materialized only once, and shared by all of them.
+///
+/// The identity map does not observe the database. Entries must be invalidated explicitly when the underlying
+/// rows change, which the DataMapper does for its own Update() and Delete() calls.
+///
+/// @see DataMapper::EnableIdentityMap()
+/// @ingroup DataMapper
+class IdentityMap
+{
+  public:
+    /// Retrieves the record of the given type and primary key, or nullptr if it is not in the identity map.
+    template <typename Record, typename Key>
+    [[nodiscard]] std::shared_ptr<Record> Find(Key const& key) const
+    {
+        auto const tableIter = _tables.find(typeid(Table<Record, Key>));
+        if (tableIter == _tables.end())
+            return nullptr;
+
+        auto const& records = static_cast<Table<Record, Key> const&>(*tableIter->second).records;
+        auto const recordIter = records.find(key);
+        return recordIter != records.end() ? recordIter->second : nullptr;
+    }
+
+    /// Puts the given record into the identity map, replacing the previous instance with the same primary key.
+    template <typename Record, typename Key>
+    void Put(Key const& key, std::shared_ptr<Record> record)
+    {
+        auto& table = _tables[typeid(Table<Record, Key>)];
+        if (!table)
+            table = std::make_unique<Table<Record, Key>>();
+
+        static_cast<Table<Record, Key>&>(*table).records.insert_or_assign(key, std::move(record));
+    }
+
+    /// Removes the record of the given type and primary key from the identity map.
+    template <typename Record, typename Key>
+    void Erase(Key const& key)
+    {
+        if (auto const tableIter = _tables.find(typeid(Table<Record, Key>)); tableIter != _tables.end())
+            static_cast<Table<Record, Key>&>(*tableIter->second).records.erase(key);
+    }
+
+    /// Removes all records of the given type and primary key type from the identity map.
+    template <typename Record, typename Key>
+    void EraseAll() noexcept
+    {
+        _tables.erase(typeid(Table<Record, Key>));
+    }
+
+    /// Removes all records from the identity map.
+    void Clear() noexcept
+    {
+        _tables.clear();
+    }
+
+    /// Retrieves the total number of records in the identity map.
+    [[nodiscard]] std::size_t Size() const noexcept
+    {
+        auto size = std::size_t { 0 };
+        for (auto const& [_, table]: _tables)
+            size += table->Size();
+        return size;
+    }
+
+  private:
+    struct TableBase
+    {
+        virtual ~TableBase() = default;
+        [[nodiscard]] virtual std::size_t Size() const noexcept = 0;
+    };
+
+    template <typename Record, typename Key>
+    struct Table final: TableBase
+    {
+        std::map<Key, std::shared_ptr<Record>> records;
+
+        [[nodiscard]] std::size_t Size() const noexcept override
+        {
+            return records.size();
+        }
+    };
+
+    std::unordered_map<std::type_index, std::unique_ptr<TableBase>> _tables;
+};
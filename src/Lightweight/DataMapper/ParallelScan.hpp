@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "../SqlConnectInfo.hpp"
+#include "../SqlConnection.hpp"
+#include "../SqlConnectionPool.hpp"
+#include "../SqlQueryExecutor.hpp"
+#include "../SqlStatement.hpp"
+#include "DataMapper.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <future>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/// Configuration of ParallelScan().
+struct SqlParallelScanConfig
+{
+    /// Number of partitions the key range is split into, each scanned on its own connection and thread.
+    std::size_t partitionCount = 4;
+
+    /// Number of records handed to the sink at once.
+    std::size_t batchSize = 1'000;
+
+    /// Connection string to scan on, or std::nullopt to use the default connection string.
+    std::optional<SqlConnectionString> connectionString;
+};
+
+/// @brief Scans all records of the table of @p Record in parallel, partitioned by the given integer column.
+///
+/// The range between the minimum and maximum value of @p partitionColumn is split into
+/// SqlParallelScanConfig::partitionCount equally wide ranges. Each range is selected by its own statement,
+/// on its own connection acquired from @p pool, and on its own thread (see SqlQueryExecutor).
+/// The fetched records are handed to @p sink in batches of up to SqlParallelScanConfig::batchSize records.
+///
+/// The scan scales with the number of partitions as long as the server can serve them in parallel,
+/// and the key values are evenly distributed (e.g. an auto-incremented primary key).
+///
+/// @note The sink is called concurrently from all partition threads, and hence must be thread-safe.
+///       Records whose partition column is NULL are not scanned. Relations of the records are not loaded.
+///
+/// @code
+/// auto total = std::atomic<double> {};
+/// auto const count = ParallelScan<Rating>(pool, "id", [&](std::span<Rating> ratings) {
+///     for (auto const& rating: ratings)
+///         total += rating.value.Value();
+/// });
+/// @endcode
+///
+/// @throws the first exception thrown by any partition scan or the sink, after all partitions have finished.
+/// @return The total number of scanned records.
+///
+/// @ingroup DataMapper
+template <typename Record, typename Sink>
+    requires std::invocable<Sink&, std::span<Record>>
+std::size_t ParallelScan(SqlConnectionPool& pool,
+                         std::string_view partitionColumn,
+                         Sink&& sink,
+                         SqlParallelScanConfig const& config = {})
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+
+    if (config.partitionCount == 0 || config.batchSize == 0)
+        throw std::invalid_argument { "The partition count and batch size must not be zero" };
+
+    // Determine the key range to partition, and the query selecting the records of a partition.
+    auto range = std::optional<std::pair<std::int64_t, std::int64_t>> {};
+    auto query = std::string {};
+    {
+        auto connection = config.connectionString ? pool.Acquire(*config.connectionString) : pool.Acquire();
+        auto stmt = SqlStatement { connection };
+        stmt.ExecuteDirect(
+            std::format(R"sql(SELECT MIN("{0}"), MAX("{0}") FROM "{1}")sql", partitionColumn, RecordTableName<Record>));
+        if (stmt.FetchRow())
+        {
+            auto const minValue = stmt.GetNullableColumn<std::int64_t>(1);
+            auto const maxValue = stmt.GetNullableColumn<std::int64_t>(2);
+            if (minValue && maxValue)
+                range.emplace(*minValue, *maxValue);
+            stmt.CloseCursor();
+        }
+
+        query = connection.Query(RecordTableName<Record>)
+                    .Select()
+                    .template Fields<Record>()
+                    .Where(partitionColumn, ">=", SqlWildcard)
+                    .Where(partitionColumn, "<=", SqlWildcard)
+                    .All()
+                    .ToSql();
+    }
+
+    if (!range)
+        return 0; // The table is empty
+
+    // Scans the records with partition column values within [first, last].
+    auto const scanPartition = [&query, &sink, batchSize = config.batchSize](
+                                   SqlConnection& connection, std::int64_t first, std::int64_t last) -> std::size_t {
+        auto stmt = SqlStatement { connection };
+        stmt.Prepare(query);
+        stmt.Execute(first, last);
+
+        auto record = Record {};
+        detail::BindRecordOutputColumns(record, stmt);
+
+        auto batch = std::vector<Record> {};
+        batch.reserve(batchSize);
+        auto count = std::size_t { 0 };
+        while (stmt.FetchRow())
+        {
+            batch.emplace_back(record);
+            if (batch.size() == batchSize)
+            {
+                sink(std::span { batch });
+                count += batch.size();
+                batch.clear();
+            }
+        }
+        if (!batch.empty())
+        {
+            sink(std::span { batch });
+            count += batch.size();
+        }
+        return count;
+    };
+
+    // Split [min, max] into equally wide partitions, computed on the unsigned offsets from min to avoid overflows.
+    auto const [minValue, maxValue] = *range;
+    auto const lastOffset = static_cast<std::uint64_t>(maxValue) - static_cast<std::uint64_t>(minValue);
+    auto const width = (lastOffset / config.partitionCount) + 1;
+
+    auto executor = SqlQueryExecutor {
+        pool,
+        { .concurrency = config.partitionCount,
+          .queueCapacity = config.partitionCount,
+          .connectionString = config.connectionString },
+    };
+
+    auto partitions = std::vector<std::future<std::size_t>> {};
+    for (auto offset = std::uint64_t { 0 };
+         partitions.size() < config.partitionCount && offset <= lastOffset;
+         offset += width)
+    {
+        auto const first = static_cast<std::int64_t>(static_cast<std::uint64_t>(minValue) + offset);
+        auto const last = static_cast<std::int64_t>(
+            static_cast<std::uint64_t>(minValue) + (lastOffset - offset < width ? lastOffset : offset + width - 1));
+        partitions.emplace_back(executor.Submit([&scanPartition, first, last](SqlConnection& connection) {
+            return scanPartition(connection, first, last);
+        }));
+    }
+
+    // Should a partition fail, the executor still completes the others before the exception leaves this function.
+    auto total = std::size_t { 0 };
+    for (auto& partition: partitions)
+        total += partition.get();
+    return total;
+}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SqlAsync.hpp"
+
+#include <algorithm>
+#include <thread>
+
+void SqlReactor::Spawn(SqlTask<void> task)
+{
+    task.Start();
+    if (task.Done())
+        task.Get(); // Completed synchronously, rethrows its exception (if any)
+    else
+        m_tasks.emplace_back(std::move(task));
+}
+
+std::size_t SqlReactor::RunOnce()
+{
+    // Re-issue the calls in flight first, and only then resume the completed ones,
+    // as resumed coroutines may put further calls in flight.
+    m_completed.clear();
+    std::erase_if(m_pending, [this](Pending const& pending) {
+        pending.awaiter->m_result = pending.awaiter->m_call();
+        if (pending.awaiter->m_result == SQL_STILL_EXECUTING)
+            return false;
+        m_completed.emplace_back(pending.continuation);
+        return true;
+    });
+
+    // A resumed coroutine may destroy another task whose call has completed in this round as well,
+    // in which case Abandon() has cleared that continuation.
+    auto const completedCount = m_completed.size();
+    for (auto const continuation: m_completed)
+        if (continuation)
+            continuation.resume();
+
+    // Reap all completed tasks before reporting a failure, keeping any further failed task for the next call.
+    auto failure = std::exception_ptr {};
+    for (auto task = m_tasks.begin(); task != m_tasks.end();)
+    {
+        if (!task->Done() || (failure && task->m_handle.promise().exception))
+        {
+            ++task;
+            continue;
+        }
+        auto completedTask = std::move(*task);
+        task = m_tasks.erase(task);
+        failure = completedTask.m_handle.promise().exception;
+    }
+
+    if (failure)
+        std::rethrow_exception(failure);
+
+    return completedCount;
+}
+
+void SqlReactor::Run()
+{
+    while (!m_tasks.empty())
+        if (RunOnce() == 0)
+            Idle();
+}
+
+void SqlReactor::Abandon(PollAwaiter& awaiter) noexcept
+{
+    if (std::erase_if(m_pending, [&](Pending const& pending) { return pending.awaiter == &awaiter; }) != 0)
+    {
+        // The call is still in flight. In polling mode, the cancellation only takes effect once the
+        // driver has been polled again, so keep re-issuing the call until it is no longer executing.
+        SQLCancel(awaiter.m_hStmt);
+        while (awaiter.m_call() == SQL_STILL_EXECUTING)
+            Idle();
+    }
+    std::ranges::replace(m_completed, awaiter.m_continuation, std::coroutine_handle<> {});
+}
+
+void SqlReactor::Idle() const
+{
+    if (m_pollInterval.count() > 0)
+        std::this_thread::sleep_for(m_pollInterval);
+    else
+        std::this_thread::yield();
+}
@@ -0,0 +1,358 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <Windows.h>
+#endif
+
+#include "Api.hpp"
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <sql.h>
+#include <sqlext.h>
+#include <sqltypes.h>
+
+template <typename T>
+class SqlTask;
+
+namespace detail
+{
+
+struct SqlTaskPromiseBase
+{
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+
+    // Resumes the awaiting coroutine (if any) when the task completes.
+    struct FinalAwaiter
+    {
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            if (auto const continuation = handle.promise().continuation)
+                return continuation;
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception() noexcept
+    {
+        exception = std::current_exception();
+    }
+};
+
+template <typename T>
+struct SqlTaskPromise: SqlTaskPromiseBase
+{
+    std::optional<T> value;
+
+    void return_value(T result)
+    {
+        value.emplace(std::move(result));
+    }
+
+    T Result()
+    {
+        if (exception)
+            std::rethrow_exception(exception);
+        return std::move(*value);
+    }
+};
+
+template <>
+struct SqlTaskPromise<void>: SqlTaskPromiseBase
+{
+    void return_void() const noexcept {}
+
+    void Result() const
+    {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+};
+
+} // namespace detail
+
+/// @brief Lazily started coroutine task, as returned by the asynchronous SqlStatement functions.
+///
+/// The task starts running when being awaited (or run by a SqlReactor), and completes with the
+/// result of the coroutine, or rethrows the exception it has thrown.
+///
+/// @code
+/// SqlTask<int> CountEmployees(SqlReactor& reactor, SqlStatement& stmt)
+/// {
+///     co_await stmt.ExecuteDirectAsync(reactor, "SELECT COUNT(*) FROM Employees");
+///     (void) co_await stmt.FetchRowAsync(reactor);
+///     co_return stmt.GetColumn<int>(1);
+/// }
+/// @endcode
+///
+/// @see SqlReactor
+template <typename T = void>
+class [[nodiscard]] SqlTask final
+{
+  public:
+    struct promise_type: detail::SqlTaskPromise<T>
+    {
+        SqlTask get_return_object() noexcept
+        {
+            return SqlTask { std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+    };
+
+    SqlTask(SqlTask&& other) noexcept:
+        m_handle { std::exchange(other.m_handle, {}) }
+    {
+    }
+
+    SqlTask& operator=(SqlTask&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Destroy();
+            m_handle = std::exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    SqlTask(SqlTask const&) = delete;
+    SqlTask& operator=(SqlTask const&) = delete;
+
+    ~SqlTask()
+    {
+        Destroy();
+    }
+
+    /// Tests if the task has run to completion.
+    [[nodiscard]] bool Done() const noexcept
+    {
+        return !m_handle || m_handle.done();
+    }
+
+    /// Retrieves the result of the completed task, or rethrows the exception it completed with.
+    T Get()
+    {
+        return m_handle.promise().Result();
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return Done();
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+    {
+        m_handle.promise().continuation = continuation;
+        return m_handle;
+    }
+
+    T await_resume()
+    {
+        return Get();
+    }
+
+  private:
+    friend class SqlReactor;
+
+    explicit SqlTask(std::coroutine_handle<promise_type> handle) noexcept:
+        m_handle { handle }
+    {
+    }
+
+    void Start()
+    {
+        if (!m_handle.done())
+            m_handle.resume();
+    }
+
+    // Destroys the coroutine frame, cancelling the ODBC call it may still be awaiting.
+    void Destroy() noexcept
+    {
+        if (auto const handle = std::exchange(m_handle, {}))
+            handle.destroy();
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/// @brief Multiplexes many in-flight asynchronous ODBC calls on a single thread.
+///
+/// Asynchronous statement functions (e.g. SqlStatement::ExecuteAsync()) enable SQL_ATTR_ASYNC_ENABLE on their
+/// statement, and await the ODBC call via Poll(). If the driver returns SQL_STILL_EXECUTING, the awaiting
+/// coroutine is suspended and the call is parked on the reactor, which re-issues it on every RunOnce()
+/// (as required by ODBC's polling mode), and resumes the coroutine once the call has completed.
+///
+/// Drivers not supporting asynchronous execution complete the calls synchronously, in which case
+/// the coroutines simply do not suspend.
+///
+/// Destroying a task while it awaits a call in flight (e.g. when the reactor is destroyed, or when
+/// RunUntilComplete() is left by an exception) cancels that call via SQLCancel() and waits for the
+/// driver to acknowledge the cancellation, so the statement is idle again afterwards.
+///
+/// @note ODBC permits only one statement per connection to execute asynchronously at a time,
+///       so each concurrently running task should use its own connection.
+///
+/// @code
+/// auto reactor = SqlReactor {};
+/// for (auto& stmt: statements)
+///     reactor.Spawn(CountEmployees(reactor, stmt));
+/// reactor.Run();
+/// @endcode
+class LIGHTWEIGHT_API SqlReactor final
+{
+  public:
+    /// Awaits the completion of an ODBC call, re-issuing it until it no longer returns SQL_STILL_EXECUTING.
+    class [[nodiscard]] PollAwaiter final
+    {
+      public:
+        PollAwaiter(SqlReactor& reactor, SQLHSTMT hStmt, std::function<SQLRETURN()> call) noexcept:
+            m_reactor { reactor },
+            m_hStmt { hStmt },
+            m_call { std::move(call) }
+        {
+        }
+
+        PollAwaiter(PollAwaiter&&) = delete;
+        PollAwaiter(PollAwaiter const&) = delete;
+        PollAwaiter& operator=(PollAwaiter&&) = delete;
+        PollAwaiter& operator=(PollAwaiter const&) = delete;
+
+        ~PollAwaiter()
+        {
+            if (m_continuation)
+                m_reactor.Abandon(*this);
+        }
+
+        [[nodiscard]] bool await_ready()
+        {
+            m_result = m_call();
+            return m_result != SQL_STILL_EXECUTING;
+        }
+
+        void await_suspend(std::coroutine_handle<> continuation)
+        {
+            m_reactor.m_pending.emplace_back(Pending { .awaiter = this, .continuation = continuation });
+            m_continuation = continuation;
+        }
+
+        [[nodiscard]] SQLRETURN await_resume() const noexcept
+        {
+            return m_result;
+        }
+
+      private:
+        friend class SqlReactor;
+
+        SqlReactor& m_reactor;
+        SQLHSTMT m_hStmt;
+        std::function<SQLRETURN()> m_call;
+        SQLRETURN m_result = SQL_STILL_EXECUTING;
+        std::coroutine_handle<> m_continuation;
+    };
+
+    /// Constructs a reactor, pausing for the given interval whenever Run() polled without any call completing.
+    explicit SqlReactor(std::chrono::microseconds pollInterval = std::chrono::microseconds(100)) noexcept:
+        m_pollInterval { pollInterval }
+    {
+    }
+
+    SqlReactor(SqlReactor&&) = delete;
+    SqlReactor(SqlReactor const&) = delete;
+    SqlReactor& operator=(SqlReactor&&) = delete;
+    SqlReactor& operator=(SqlReactor const&) = delete;
+    ~SqlReactor() = default;
+
+    /// Awaits the given ODBC call on the given statement on this reactor.
+    ///
+    /// The call is re-issued with the same arguments on each poll, so it must capture them by reference.
+    /// The statement is cancelled if the awaiting coroutine is destroyed while the call is still in flight.
+    [[nodiscard]] PollAwaiter Poll(SQLHSTMT hStmt, std::function<SQLRETURN()> call) noexcept
+    {
+        return PollAwaiter { *this, hStmt, std::move(call) };
+    }
+
+    /// Starts the given task, owning it until it has completed.
+    void Spawn(SqlTask<void> task);
+
+    /// Retrieves the number of ODBC calls currently in flight.
+    [[nodiscard]] std::size_t PendingCount() const noexcept
+    {
+        return m_pending.size();
+    }
+
+    /// Polls each ODBC call in flight once, and resumes the coroutines of the completed ones.
+    ///
+    /// @throws the exception a spawned task has completed with, if any. It is rethrown only after all
+    ///         calls in flight have been polled and all completed tasks have been reaped, and further
+    ///         failed tasks are kept to be reported by the next call.
+    /// @return The number of calls that have completed.
+    std::size_t RunOnce();
+
+    /// Runs until all spawned tasks have completed.
+    void Run();
+
+    /// Runs the given task (and all spawned tasks in the meantime) until it has completed.
+    ///
+    /// @return The result of the task.
+    template <typename T>
+    T RunUntilComplete(SqlTask<T> task)
+    {
+        task.Start();
+        try
+        {
+            while (!task.Done())
+                if (RunOnce() == 0)
+                    Idle();
+        }
+        catch (...)
+        {
+            // A spawned task has failed: cancel the call the given task may be awaiting before unwinding.
+            task.Destroy();
+            throw;
+        }
+        return task.Get();
+    }
+
+  private:
+    struct Pending
+    {
+        PollAwaiter* awaiter;
+        std::coroutine_handle<> continuation;
+    };
+
+    // Unregisters an awaiter being destroyed, cancelling its call if it is still in flight.
+    void Abandon(PollAwaiter& awaiter) noexcept;
+
+    void Idle() const;
+
+    std::chrono::microseconds m_pollInterval;
+    std::vector<Pending> m_pending;
+    std::vector<std::coroutine_handle<>> m_completed;
+    std::vector<SqlTask<void>> m_tasks;
+};
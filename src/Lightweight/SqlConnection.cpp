@@ -1,9 +1,16 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "SqlConnection.hpp"
+#include "SqlConnectionPool.hpp"
 #include "SqlQuery.hpp"
 #include "SqlQueryFormatter.hpp"
 
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <utility>
+
 #include <sql.h>
 
 using namespace std::chrono_literals;
@@ -13,6 +20,80 @@ static SqlConnectionString gDefaultConnectionString {};
 static std::atomic<uint64_t> gNextConnectionId { 1 };
 static std::function<void(SqlConnection&)> gPostConnectedHook {};
 
+// Process-wide ODBC environment, shared by all connections and released with the last one.
+static std::mutex gSharedEnvironmentMutex {};
+static SQLHENV gSharedEnvironment {};
+static std::size_t gSharedEnvironmentRefCount {};
+static bool gDriverManagerConnectionPooling {};
+
+static SQLHENV AcquireSharedEnvironment()
+{
+    auto const _ = std::lock_guard { gSharedEnvironmentMutex };
+
+    if (gSharedEnvironmentRefCount == 0)
+    {
+        // Must be set before the environment is allocated in order to take effect.
+        if (gDriverManagerConnectionPooling)
+            SQLSetEnvAttr(SQL_NULL_HANDLE,
+                          SQL_ATTR_CONNECTION_POOLING,
+                          (SQLPOINTER) SQL_CP_ONE_PER_HENV, // NOLINT(performance-no-int-to-ptr)
+                          SQL_IS_UINTEGER);
+
+        // There is no handle to retrieve diagnostics from if the allocation fails.
+        if (!SQL_SUCCEEDED(SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &gSharedEnvironment)))
+        {
+            gSharedEnvironment = {};
+            throw SqlException(SqlErrorInfo {
+                .sqlState = "HY001",
+                .message = "Failed to allocate the ODBC environment handle.",
+            });
+        }
+
+        if (!SQL_SUCCEEDED(SQLSetEnvAttr(gSharedEnvironment, SQL_ATTR_ODBC_VERSION, (SQLPOINTER) SQL_OV_ODBC3, 0)))
+        {
+            auto errorInfo = SqlErrorInfo::fromEnvironmentHandle(gSharedEnvironment);
+            SQLFreeHandle(SQL_HANDLE_ENV, gSharedEnvironment);
+            gSharedEnvironment = {};
+            throw SqlException(std::move(errorInfo));
+        }
+
+        if (gDriverManagerConnectionPooling)
+            SQLSetEnvAttr(gSharedEnvironment,
+                          SQL_ATTR_CP_MATCH,
+                          (SQLPOINTER) SQL_CP_RELAXED_MATCH, // NOLINT(performance-no-int-to-ptr)
+                          SQL_IS_UINTEGER);
+    }
+
+    // Only counted once the environment exists, such that a failed allocation is retried by the next connection.
+    ++gSharedEnvironmentRefCount;
+    return gSharedEnvironment;
+}
+
+static void ReleaseSharedEnvironment()
+{
+    auto const _ = std::lock_guard { gSharedEnvironmentMutex };
+
+    if (--gSharedEnvironmentRefCount == 0)
+    {
+        SQLFreeHandle(SQL_HANDLE_ENV, gSharedEnvironment);
+        gSharedEnvironment = {};
+    }
+}
+
+// Allocates a connection handle on the shared environment, which is released again if the allocation fails.
+static std::pair<SQLHENV, SQLHDBC> AllocateConnectionHandles()
+{
+    auto const hEnv = AcquireSharedEnvironment();
+    auto hDbc = SQLHDBC {};
+    if (!SQL_SUCCEEDED(SQLAllocHandle(SQL_HANDLE_DBC, hEnv, &hDbc)))
+    {
+        auto errorInfo = SqlErrorInfo::fromEnvironmentHandle(hEnv);
+        ReleaseSharedEnvironment();
+        throw SqlException(std::move(errorInfo));
+    }
+    return { hEnv, hDbc };
+}
+
 // =====================================================================================================================
 
 struct SqlConnection::Data
@@ -20,26 +101,27 @@ struct SqlConnection::Data
     std::chrono::steady_clock::time_point lastUsed; // Last time the connection was used (mostly interesting for
                                                     // idle connections in the connection pool).
     SqlConnectionString connectionString;
+    SqlConnectionPool* pool = nullptr; // The pool this connection is returned to on Close(), if any.
+    SqlStatementCache statementCache;  // Prepared statements, kept alive across SqlStatement instances.
 };
 
 SqlConnection::SqlConnection():
-    m_connectionId { gNextConnectionId++ },
-    m_data { new Data() }
+    m_connectionId { gNextConnectionId++ }
 {
-    SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &m_hEnv);
-    SQLSetEnvAttr(m_hEnv, SQL_ATTR_ODBC_VERSION, (SQLPOINTER) SQL_OV_ODBC3, 0);
-    SQLAllocHandle(SQL_HANDLE_DBC, m_hEnv, &m_hDbc);
+    // The data is only handed over once the handles exist, as the destructor does not run if this throws.
+    auto data = std::make_unique<Data>();
+    std::tie(m_hEnv, m_hDbc) = AllocateConnectionHandles();
+    m_data = data.release();
 
     Connect(DefaultConnectionString());
 }
 
 SqlConnection::SqlConnection(std::optional<SqlConnectionString> connectInfo):
-    m_connectionId { gNextConnectionId++ },
-    m_data { new Data() }
+    m_connectionId { gNextConnectionId++ }
 {
-    SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &m_hEnv);
-    SQLSetEnvAttr(m_hEnv, SQL_ATTR_ODBC_VERSION, (SQLPOINTER) SQL_OV_ODBC3, 0);
-    SQLAllocHandle(SQL_HANDLE_DBC, m_hEnv, &m_hDbc);
+    auto data = std::make_unique<Data>();
+    std::tie(m_hEnv, m_hDbc) = AllocateConnectionHandles();
+    m_data = data.release();
 
     if (connectInfo.has_value())
         Connect(std::move(*connectInfo));
@@ -63,11 +145,15 @@ SqlConnection& SqlConnection::operator=(SqlConnection&& other) noexcept
     if (this == &other)
         return *this;
 
+    // Close() leaves (possibly new) data behind, which this object does not need anymore.
     Close();
+    delete m_data;
 
     m_hEnv = other.m_hEnv;
     m_hDbc = other.m_hDbc;
     m_connectionId = other.m_connectionId;
+    m_serverType = other.m_serverType;
+    m_queryFormatter = other.m_queryFormatter;
     m_data = other.m_data;
 
     other.m_hEnv = {};
@@ -102,19 +188,30 @@ void SqlConnection::SetDefaultDataSource(SqlConnectionDataSource const& dataSour
                                                                           dataSource.timeout.count()) };
 }
 
+// The accessors below also have to work on moved-from connections, which have no data of their own.
+
 SqlConnectionString const& SqlConnection::ConnectionString() const noexcept
 {
-    return m_data->connectionString;
+    static auto const noConnectionString = SqlConnectionString {};
+    return m_data ? m_data->connectionString : noConnectionString;
+}
+
+SqlStatementCache& SqlConnection::StatementCache() noexcept
+{
+    // A connection without a connection handle never allocates statements, so this cache always stays empty.
+    thread_local auto detachedCache = SqlStatementCache {};
+    return m_data ? m_data->statementCache : detachedCache;
 }
 
 void SqlConnection::SetLastUsed(std::chrono::steady_clock::time_point lastUsed) noexcept
 {
-    m_data->lastUsed = lastUsed;
+    if (m_data)
+        m_data->lastUsed = lastUsed;
 }
 
 std::chrono::steady_clock::time_point SqlConnection::LastUsed() const noexcept
 {
-    return m_data->lastUsed;
+    return m_data ? m_data->lastUsed : std::chrono::steady_clock::time_point {};
 }
 
 void SqlConnection::SetPostConnectedHook(std::function<void(SqlConnection&)> hook)
@@ -127,13 +224,20 @@ void SqlConnection::ResetPostConnectedHook()
     gPostConnectedHook = {};
 }
 
+void SqlConnection::SetDriverManagerConnectionPooling(bool enabled) noexcept
+{
+    auto const _ = std::lock_guard { gSharedEnvironmentMutex };
+    gDriverManagerConnectionPooling = enabled;
+}
+
 bool SqlConnection::Connect(SqlConnectionDataSource const& info) noexcept
 {
     // NOLINTNEXTLINE(performance-no-int-to-ptr)
     SQLRETURN sqlReturn = SQLSetConnectAttrA(m_hDbc, SQL_LOGIN_TIMEOUT, (SQLPOINTER) info.timeout.count(), 0);
     if (!SQL_SUCCEEDED(sqlReturn))
     {
-        SqlLogger::GetLogger().OnError(LastError());
+        if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+            SqlLogger::GetLogger().OnError(LastError());
         return false;
     }
 
@@ -146,20 +250,23 @@ bool SqlConnection::Connect(SqlConnectionDataSource const& info) noexcept
                             (SQLSMALLINT) info.password.size());
     if (!SQL_SUCCEEDED(sqlReturn))
     {
-        SqlLogger::GetLogger().OnError(LastError());
+        if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+            SqlLogger::GetLogger().OnError(LastError());
         return false;
     }
 
     sqlReturn = SQLSetConnectAttrA(m_hDbc, SQL_ATTR_AUTOCOMMIT, (SQLPOINTER) SQL_AUTOCOMMIT_ON, SQL_IS_UINTEGER);
     if (!SQL_SUCCEEDED(sqlReturn))
     {
-        SqlLogger::GetLogger().OnError(LastError());
+        if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+            SqlLogger::GetLogger().OnError(LastError());
         return false;
     }
 
     PostConnect();
 
-    SqlLogger::GetLogger().OnConnectionOpened(*this);
+    if (SqlLogger::IsEnabled(SqlLogger::Event::CONNECTIONS))
+        SqlLogger::GetLogger().OnConnectionOpened(*this);
 
     if (gPostConnectedHook)
         gPostConnectedHook(*this);
@@ -193,7 +300,8 @@ bool SqlConnection::Connect(SqlConnectionString sqlConnectionString) noexcept
         return false;
 
     PostConnect();
-    SqlLogger::GetLogger().OnConnectionOpened(*this);
+    if (SqlLogger::IsEnabled(SqlLogger::Event::CONNECTIONS))
+        SqlLogger::GetLogger().OnConnectionOpened(*this);
 
     if (gPostConnectedHook)
         gPostConnectedHook(*this);
@@ -234,11 +342,23 @@ void SqlConnection::Close() noexcept
     if (!m_hDbc)
         return;
 
-    SqlLogger::GetLogger().OnConnectionClosed(*this);
+    if (m_data && m_data->pool)
+    {
+        auto* pool = std::exchange(m_data->pool, nullptr);
+        pool->Release(std::move(*this));
+
+        // Leave this object behind in a valid, disconnected state.
+        m_data = new (std::nothrow) Data();
+        return;
+    }
+
+    if (SqlLogger::IsEnabled(SqlLogger::Event::CONNECTIONS))
+        SqlLogger::GetLogger().OnConnectionClosed(*this);
 
+    m_data->statementCache.Clear();
     SQLDisconnect(m_hDbc);
     SQLFreeHandle(SQL_HANDLE_DBC, m_hDbc);
-    SQLFreeHandle(SQL_HANDLE_ENV, m_hEnv);
+    ReleaseSharedEnvironment();
 
     m_hDbc = {};
     m_hEnv = {};
@@ -308,7 +428,8 @@ void SqlConnection::RequireSuccess(SQLRETURN error, std::source_location sourceL
         return;
 
     auto errorInfo = LastError();
-    SqlLogger::GetLogger().OnError(errorInfo, sourceLocation);
+    if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+        SqlLogger::GetLogger().OnError(errorInfo, sourceLocation);
     throw SqlException(std::move(errorInfo));
 }
 
@@ -10,6 +10,7 @@
 #include "SqlConnectInfo.hpp"
 #include "SqlError.hpp"
 #include "SqlLogger.hpp"
+#include "SqlStatementCache.hpp"
 #include "SqlTraits.hpp"
 
 #include <atomic>
@@ -31,6 +32,7 @@
 class SqlQueryBuilder;
 class SqlMigrationQueryBuilder;
 class SqlQueryFormatter;
+class SqlConnectionPool;
 
 /// @brief Represents a connection to a SQL database.
 class LIGHTWEIGHT_API SqlConnection final
@@ -41,12 +43,16 @@ class LIGHTWEIGHT_API SqlConnection final
     /// The default connection is set via SetDefaultConnectInfo.
     /// In case the default connection is not set, the connection will fail.
     /// And in case the connection fails, the last error will be set.
+    ///
+    /// @throws SqlException if the ODBC environment or connection handle cannot be allocated.
     SqlConnection();
 
     /// @brief Constructs a new SQL connection to the given connect informaton.
     ///
     /// @param connectInfo The connection information to use. If not provided,
     ///                    no connection will be established.
+    ///
+    /// @throws SqlException if the ODBC environment or connection handle cannot be allocated.
     explicit SqlConnection(std::optional<SqlConnectionString> connectInfo);
 
     SqlConnection(SqlConnection&& /*other*/) noexcept;
@@ -74,6 +80,13 @@ class LIGHTWEIGHT_API SqlConnection final
     /// Resets the post connected hook.
     static void ResetPostConnectedHook();
 
+    /// Enables or disables ODBC driver manager level connection pooling (SQL_ATTR_CONNECTION_POOLING).
+    ///
+    /// All connections share a single, process-wide ODBC environment handle.
+    /// This setting takes effect the next time that environment is allocated,
+    /// i.e. it must be set before the first connection is created.
+    static void SetDriverManagerConnectionPooling(bool enabled) noexcept;
+
     /// @brief Retrieves the connection ID.
     ///
     /// This is a unique identifier for the connection, which is useful for debugging purposes.
@@ -83,7 +96,9 @@ class LIGHTWEIGHT_API SqlConnection final
         return m_connectionId;
     }
 
-    /// Closes the connection (attempting to put it back into the connect[[ion pool).
+    /// Closes the connection.
+    ///
+    /// If the connection has been acquired from a SqlConnectionPool, it is put back into the pool instead.
     void Close() noexcept;
 
     /// Connects to the given database with the given username and password.
@@ -158,6 +173,9 @@ class LIGHTWEIGHT_API SqlConnection final
         return m_hDbc;
     }
 
+    /// Retrieves the prepared statement cache of this connection.
+    [[nodiscard]] SqlStatementCache& StatementCache() noexcept;
+
     /// Retrieves the last time the connection was used.
     [[nodiscard]] std::chrono::steady_clock::time_point LastUsed() const noexcept;
 
@@ -169,10 +187,12 @@ class LIGHTWEIGHT_API SqlConnection final
                         std::source_location sourceLocation = std::source_location::current()) const;
 
   private:
+    friend class SqlConnectionPool;
+
     void PostConnect();
 
     // Private data members
-    SQLHENV m_hEnv {};
+    SQLHENV m_hEnv {}; // Shared across all connections.
     SQLHDBC m_hDbc {};
     uint64_t m_connectionId;
     SqlServerType m_serverType = SqlServerType::UNKNOWN;
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SqlConnectionPool.hpp"
+#include "SqlError.hpp"
+#include "SqlLogger.hpp"
+
+#include <format>
+#include <new>
+#include <ranges>
+#include <vector>
+
+SqlConnectionPool::SqlConnectionPool(SqlConnectionPoolConfig config):
+    m_config { config }
+{
+    if (m_config.reapInterval.count() <= 0)
+        return;
+
+    m_reaper = std::jthread([this](std::stop_token stopToken) {
+        while (true)
+        {
+            {
+                auto lock = std::unique_lock { m_mutex };
+                (void) m_reaperWakeup.wait_for(lock, stopToken, m_config.reapInterval, [] { return false; });
+            }
+
+            if (stopToken.stop_requested())
+                return;
+
+            Reap();
+        }
+    });
+}
+
+SqlConnectionPool::~SqlConnectionPool()
+{
+    if (m_reaper.joinable())
+    {
+        m_reaper.request_stop();
+        m_reaper.join();
+    }
+
+    Clear();
+}
+
+SqlConnection SqlConnectionPool::Acquire()
+{
+    return Acquire(SqlConnection::DefaultConnectionString());
+}
+
+SqlConnection SqlConnectionPool::Acquire(SqlConnectionString const& connectionString)
+{
+    auto const deadline = std::chrono::steady_clock::now() + m_config.acquireTimeout;
+    auto lock = std::unique_lock { m_mutex };
+    auto& bucket = m_buckets[connectionString.value];
+
+    while (true)
+    {
+        while (!bucket.idle.empty())
+        {
+            // Prefer the most recently used connection, as it is the least likely to have been dropped by the server.
+            auto connection = std::move(bucket.idle.back());
+            bucket.idle.pop_back();
+            lock.unlock();
+
+            if (connection.IsAlive())
+            {
+                connection.m_data->pool = this;
+                connection.SetLastUsed(std::chrono::steady_clock::now());
+                if (SqlLogger::IsEnabled(SqlLogger::Event::CONNECTIONS))
+                    SqlLogger::GetLogger().OnConnectionReuse(connection);
+                return connection;
+            }
+
+            connection.Close();
+            lock.lock();
+            --bucket.total;
+        }
+
+        if (bucket.total < m_config.maxConnections)
+        {
+            ++bucket.total;
+            lock.unlock();
+
+            auto connection = SqlConnection { connectionString };
+            if (!connection.IsAlive())
+            {
+                auto errorInfo = connection.LastError();
+                connection.Close();
+                lock.lock();
+                --bucket.total;
+                lock.unlock();
+                m_connectionReleased.notify_one();
+                throw SqlException(std::move(errorInfo));
+            }
+
+            connection.m_data->pool = this;
+            connection.SetLastUsed(std::chrono::steady_clock::now());
+            return connection;
+        }
+
+        auto const available = m_connectionReleased.wait_until(lock, deadline, [&] {
+            return !bucket.idle.empty() || bucket.total < m_config.maxConnections;
+        });
+
+        if (!available)
+            throw SqlException(SqlErrorInfo {
+                .sqlState = "HYT00",
+                .message = std::format("Timed out waiting for a pooled connection ({} of {} in use).",
+                                       bucket.total,
+                                       m_config.maxConnections),
+            });
+    }
+}
+
+void SqlConnectionPool::Release(SqlConnection&& connection) noexcept
+{
+    auto pooled = SqlConnection(std::move(connection));
+    auto const& key = pooled.ConnectionString().value;
+
+    auto reusable = pooled.IsAlive();
+    if (reusable && pooled.TransactionActive())
+    {
+        // Never hand out a connection with a pending transaction to the next user.
+        reusable = SQL_SUCCEEDED(SQLEndTran(SQL_HANDLE_DBC, pooled.NativeHandle(), SQL_ROLLBACK))
+                   && SQL_SUCCEEDED(SQLSetConnectAttrA(
+                       pooled.NativeHandle(), SQL_ATTR_AUTOCOMMIT, (SQLPOINTER) SQL_AUTOCOMMIT_ON, SQL_IS_UINTEGER));
+    }
+
+    if (reusable)
+    {
+        try
+        {
+            pooled.SetLastUsed(std::chrono::steady_clock::now());
+            if (SqlLogger::IsEnabled(SqlLogger::Event::CONNECTIONS))
+                SqlLogger::GetLogger().OnConnectionIdle(pooled);
+
+            {
+                auto const _ = std::lock_guard { m_mutex };
+                m_buckets[key].idle.emplace_back(std::move(pooled));
+            }
+            m_connectionReleased.notify_one();
+            return;
+        }
+        catch (std::bad_alloc const&)
+        {
+            // Running out of memory while pooling must not terminate, so disconnect the connection instead.
+            // A failed emplace_back() has left it untouched.
+        }
+    }
+
+    // The connection data (and thus the key) outlives Close(), and the bucket exists since the connection
+    // has been acquired, so nothing is allocated on this path.
+    pooled.Close();
+    {
+        auto const _ = std::lock_guard { m_mutex };
+        if (auto const bucket = m_buckets.find(key); bucket != m_buckets.end())
+            --bucket->second.total;
+    }
+    m_connectionReleased.notify_one();
+}
+
+void SqlConnectionPool::Reap()
+{
+    auto const expiredBefore = std::chrono::steady_clock::now() - m_config.idleTimeout;
+    auto expired = std::vector<SqlConnection> {};
+
+    {
+        auto const _ = std::lock_guard { m_mutex };
+        for (auto& bucket: m_buckets | std::views::values)
+        {
+            while (bucket.idle.size() > m_config.minIdleConnections
+                   && bucket.idle.front().LastUsed() <= expiredBefore)
+            {
+                expired.emplace_back(std::move(bucket.idle.front()));
+                bucket.idle.pop_front();
+                --bucket.total;
+            }
+        }
+    }
+
+    if (!expired.empty())
+        m_connectionReleased.notify_all();
+
+    // The expired connections are closed outside the lock, as disconnecting may involve a server round trip.
+}
+
+void SqlConnectionPool::Clear()
+{
+    auto closing = std::vector<SqlConnection> {};
+
+    {
+        auto const _ = std::lock_guard { m_mutex };
+        for (auto& bucket: m_buckets | std::views::values)
+        {
+            for (auto& connection: bucket.idle)
+                closing.emplace_back(std::move(connection));
+            bucket.total -= bucket.idle.size();
+            bucket.idle.clear();
+        }
+    }
+
+    m_connectionReleased.notify_all();
+}
+
+std::size_t SqlConnectionPool::IdleCount(SqlConnectionString const& connectionString) const
+{
+    auto const _ = std::lock_guard { m_mutex };
+    auto const it = m_buckets.find(connectionString.value);
+    return it != m_buckets.end() ? it->second.idle.size() : 0;
+}
+
+std::size_t SqlConnectionPool::TotalCount(SqlConnectionString const& connectionString) const
+{
+    auto const _ = std::lock_guard { m_mutex };
+    auto const it = m_buckets.find(connectionString.value);
+    return it != m_buckets.end() ? it->second.total : 0;
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Api.hpp"
+#include "SqlConnectInfo.hpp"
+#include "SqlConnection.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/// @brief Configures the behaviour of a SqlConnectionPool.
+struct SqlConnectionPoolConfig
+{
+    /// Number of idle connections per connection string that are kept alive, regardless of their idle time.
+    std::size_t minIdleConnections = 0;
+
+    /// Maximum number of connections (idle and in use) per connection string.
+    std::size_t maxConnections = 16;
+
+    /// Idle connections older than this are closed by the reaper.
+    std::chrono::milliseconds idleTimeout = std::chrono::seconds(60);
+
+    /// Maximum time to wait for a connection to become available before giving up.
+    std::chrono::milliseconds acquireTimeout = std::chrono::seconds(30);
+
+    /// Interval at which the background reaper checks for idle connections.
+    std::chrono::milliseconds reapInterval = std::chrono::seconds(5);
+};
+
+/// @brief Thread-safe pool of SQL connections, bucketed by connection string.
+///
+/// Connections acquired from the pool are returned to it when closed (or destroyed),
+/// instead of being disconnected. Idle connections are health-checked via SqlConnection::IsAlive()
+/// before being handed out again, and closed by a background reaper once they exceed the idle timeout.
+///
+/// @note The pool must outlive all connections that have been acquired from it.
+///
+/// @code
+/// auto pool = SqlConnectionPool {};
+/// {
+///     auto connection = pool.Acquire(); // connects to the default connection string
+///     auto stmt = SqlStatement { connection };
+///     // ...
+/// } // connection is put back into the pool here
+/// @endcode
+class LIGHTWEIGHT_API SqlConnectionPool final
+{
+  public:
+    explicit SqlConnectionPool(SqlConnectionPoolConfig config = {});
+
+    SqlConnectionPool(SqlConnectionPool&&) = delete;
+    SqlConnectionPool(SqlConnectionPool const&) = delete;
+    SqlConnectionPool& operator=(SqlConnectionPool&&) = delete;
+    SqlConnectionPool& operator=(SqlConnectionPool const&) = delete;
+
+    /// Stops the reaper and closes all idle connections.
+    ~SqlConnectionPool();
+
+    /// Acquires a connection to the default connection string.
+    [[nodiscard]] SqlConnection Acquire();
+
+    /// Acquires a connection to the given connection string.
+    ///
+    /// Reuses an idle connection if available, otherwise establishes a new one,
+    /// or waits until a connection is returned if the bucket is exhausted.
+    ///
+    /// @throws SqlException if connecting failed or no connection became available within the acquire timeout.
+    [[nodiscard]] SqlConnection Acquire(SqlConnectionString const& connectionString);
+
+    /// Closes all idle connections that exceeded the idle timeout, keeping at least the minimum number of idle
+    /// connections per bucket.
+    void Reap();
+
+    /// Closes all idle connections.
+    void Clear();
+
+    /// Retrieves the number of idle connections for the given connection string.
+    [[nodiscard]] std::size_t IdleCount(SqlConnectionString const& connectionString) const;
+
+    /// Retrieves the number of connections (idle and in use) for the given connection string.
+    [[nodiscard]] std::size_t TotalCount(SqlConnectionString const& connectionString) const;
+
+    /// Retrieves the pool configuration.
+    [[nodiscard]] SqlConnectionPoolConfig const& Config() const noexcept
+    {
+        return m_config;
+    }
+
+  private:
+    friend class SqlConnection;
+
+    // Puts the connection back into its bucket. Called by SqlConnection::Close().
+    void Release(SqlConnection&& connection) noexcept;
+
+    struct Bucket
+    {
+        std::deque<SqlConnection> idle; // Most recently used connections are at the back.
+        std::size_t total = 0;          // Number of connections, idle or in use.
+    };
+
+    SqlConnectionPoolConfig m_config;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_connectionReleased;
+    std::condition_variable_any m_reaperWakeup;
+    std::map<std::string, Bucket> m_buckets;
+    std::jthread m_reaper;
+};
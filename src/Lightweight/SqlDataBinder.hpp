@@ -11,6 +11,7 @@
 #include "DataBinder/SqlGuid.hpp"
 #include "DataBinder/SqlNullValue.hpp"
 #include "DataBinder/SqlNumeric.hpp"
+#include "DataBinder/SqlStream.hpp"
 #include "DataBinder/SqlText.hpp"
 #include "DataBinder/SqlTime.hpp"
 #include "DataBinder/SqlVariant.hpp"
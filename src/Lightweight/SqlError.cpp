@@ -7,7 +7,8 @@ SqlException::SqlException(SqlErrorInfo info, std::source_location sourceLocatio
     std::runtime_error(std::format("{}", info)),
     _info { std::move(info) }
 {
-    SqlLogger::GetLogger().OnError(info, sourceLocation);
+    if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+        SqlLogger::GetLogger().OnError(info, sourceLocation);
 }
 
 void SqlErrorInfo::RequireStatementSuccess(SQLRETURN result, SQLHSTMT hStmt, std::string_view message)
@@ -31,6 +31,12 @@ struct SqlErrorInfo
     std::string sqlState = "     "; // 5 characters + null terminator
     std::string message;
 
+    /// Constructs an ODBC error info object from the given ODBC environment handle.
+    static SqlErrorInfo fromEnvironmentHandle(SQLHENV hEnv)
+    {
+        return fromHandle(SQL_HANDLE_ENV, hEnv);
+    }
+
     /// Constructs an ODBC error info object from the given ODBC connection handle.
     static SqlErrorInfo fromConnectionHandle(SQLHDBC hDbc)
     {
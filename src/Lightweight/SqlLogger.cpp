@@ -5,11 +5,21 @@
 #include "SqlConnection.hpp"
 #include "SqlLogger.hpp"
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <format>
-#include <print>
+#include <iterator>
+#include <memory>
 #include <ranges>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <version>
 
 #if __has_include(<stacktrace>)
@@ -25,12 +35,145 @@
 namespace
 {
 
-class SqlStandardLogger: public SqlLogger
+// Writes the log lines of all threads to the standard output on a background thread.
+//
+// Lines are handed over via a bounded multi-producer single-consumer ring buffer (after Dmitry Vyukov's bounded
+// queue), so that logging threads neither block on each other nor on the console I/O, and lines are never torn.
+// If the ring buffer is full, logging threads yield until the writer has caught up, rather than dropping lines.
+class SqlLogWriter
 {
+  public:
+    static constexpr std::size_t Capacity = 8192; // Must be a power of two
+
+    SqlLogWriter():
+        _slots { std::make_unique<Slot[]>(Capacity) }
+    {
+        for (std::size_t i = 0; i < Capacity; ++i)
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+
+        _writer = std::jthread([this](std::stop_token stopToken) {
+            while (!stopToken.stop_requested())
+                if (WritePending() == 0)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            WritePending();
+        });
+    }
+
+    SqlLogWriter(SqlLogWriter const&) = delete;
+    SqlLogWriter(SqlLogWriter&&) = delete;
+    SqlLogWriter& operator=(SqlLogWriter const&) = delete;
+    SqlLogWriter& operator=(SqlLogWriter&&) = delete;
+    ~SqlLogWriter()
+    {
+        // Divert further lines to synchronous writes first, so no line is enqueued after the writer has stopped.
+        theWriterDestroyed.store(true, std::memory_order_release);
+        _writer.request_stop();
+        _writer.join(); // Writes all pending lines before returning
+    }
+
+    static SqlLogWriter& Get()
+    {
+        static SqlLogWriter theWriter {};
+        return theWriter;
+    }
+
+    // Writes the given line asynchronously, or synchronously while the process is being torn down
+    // (e.g. for connections closed by static destructors, after the writer itself has been destroyed).
+    static void Submit(std::string line)
+    {
+        if (theWriterDestroyed.load(std::memory_order_acquire))
+        {
+            line += '\n';
+            std::fwrite(line.data(), 1, line.size(), stdout);
+            return;
+        }
+        Get().Write(std::move(line));
+    }
+
+    static void FlushAll()
+    {
+        if (!theWriterDestroyed.load(std::memory_order_acquire))
+            Get().Flush();
+    }
+
+    void Write(std::string line)
+    {
+        auto position = _enqueuePosition.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true)
+        {
+            slot = &_slots[position & (Capacity - 1)];
+            auto const sequence = slot->sequence.load(std::memory_order_acquire);
+            auto const difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (difference == 0)
+            {
+                if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else
+            {
+                if (difference < 0)
+                    std::this_thread::yield(); // The ring buffer is full
+                position = _enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->line = std::move(line);
+        slot->sequence.store(position + 1, std::memory_order_release);
+    }
+
+    // Waits until all lines enqueued so far have been written.
+    void Flush()
+    {
+        auto const target = _enqueuePosition.load(std::memory_order_acquire);
+        while (_writtenCount.load(std::memory_order_acquire) < target)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
   private:
-    std::chrono::time_point<std::chrono::system_clock> _currentTime;
-    std::string _currentTimeStr;
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        std::string line;
+    };
+
+    // Writes all lines enqueued and completed so far, returning their number. Only called by the writer thread.
+    std::size_t WritePending()
+    {
+        auto count = std::size_t { 0 };
+        while (true)
+        {
+            auto& slot = _slots[_dequeuePosition & (Capacity - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != _dequeuePosition + 1)
+                break;
+
+            slot.line += '\n';
+            std::fwrite(slot.line.data(), 1, slot.line.size(), stdout);
+            slot.line.clear();
+            slot.sequence.store(_dequeuePosition + Capacity, std::memory_order_release);
+            ++_dequeuePosition;
+            ++count;
+        }
+
+        if (count != 0)
+        {
+            std::fflush(stdout);
+            _writtenCount.store(_dequeuePosition, std::memory_order_release);
+        }
+        return count;
+    }
+
+    std::unique_ptr<Slot[]> _slots;
+    std::atomic<std::size_t> _enqueuePosition = 0;
+    std::size_t _dequeuePosition = 0;
+    std::atomic<std::size_t> _writtenCount = 0;
+    std::jthread _writer;
 
+    static inline std::atomic<bool> theWriterDestroyed = false;
+};
+
+class SqlStandardLogger: public SqlLogger
+{
   public:
     SqlStandardLogger(SupportBindLogging supportBindLogging = SupportBindLogging::No):
         SqlLogger { supportBindLogging }
@@ -38,39 +181,44 @@ class SqlStandardLogger: public SqlLogger
         ConfigureConsole();
     }
 
-    void Tick()
+    // Formats the message on the calling thread, and hands it over to the background writer.
+    template <typename... Args>
+    void WriteMessage(std::format_string<Args...> const& fmt, Args&&... args)
     {
-        _currentTime = std::chrono::system_clock::now();
-        auto const nowMs = time_point_cast<std::chrono::milliseconds>(_currentTime);
-        _currentTimeStr = std::format("{:%F %X}.{:03}", _currentTime, nowMs.time_since_epoch().count() % 1'000);
+        auto const now = std::chrono::system_clock::now();
+        auto const nowMs = time_point_cast<std::chrono::milliseconds>(now);
+        auto line = std::format("[{:%F %X}.{:03}] ", now, nowMs.time_since_epoch().count() % 1'000);
+        std::format_to(std::back_inserter(line), fmt, std::forward<Args>(args)...);
+        SqlLogWriter::Submit(std::move(line));
     }
 
-    template <typename... Args>
-    void WriteMessage(std::format_string<Args...> const& fmt, Args&&... args)
+    void Flush() override
     {
-        // TODO: Use the new logging mechanism from Felix here, once merged.
-        std::println("[{}] {}", _currentTimeStr, std::format(fmt, std::forward<Args>(args)...));
+        SqlLogWriter::FlushAll();
     }
 
     void OnWarning(std::string_view const& message) override
     {
-        Tick();
         WriteMessage("Warning: {}", message);
     }
 
     void OnError(SqlError error, std::source_location /*sourceLocation*/) override
     {
-        Tick();
         WriteMessage("SQL Error: {}", error);
     }
 
+    // Multi-line messages are written as a single entry, so they are not interleaved with other threads' output.
     void OnError(SqlErrorInfo const& errorInfo, std::source_location /*sourceLocation*/) override
     {
-        Tick();
-        WriteMessage("SQL Error:");
-        WriteMessage("  SQLSTATE: {}", errorInfo.sqlState);
-        WriteMessage("  Native error code: {}", errorInfo.nativeErrorCode);
-        WriteMessage("  Message: {}", errorInfo.message);
+        WriteMessage("{}", FormatError(errorInfo));
+    }
+
+    static std::string FormatError(SqlErrorInfo const& errorInfo)
+    {
+        return std::format("SQL Error:\n  SQLSTATE: {}\n  Native error code: {}\n  Message: {}",
+                           errorInfo.sqlState,
+                           errorInfo.nativeErrorCode,
+                           errorInfo.message);
     }
 
     void ConfigureConsole()
@@ -114,12 +262,23 @@ class SqlTraceLogger: public SqlStandardLogger
         Error
     };
 
-    State _state = State::Idle;
-    std::string _lastPreparedQuery;
+    // The statement being traced by a thread. Each thread traces its own statement, so that concurrently
+    // executing statements (on different connections) do not interfere with each other.
+    struct Context
+    {
+        State state = State::Idle;
+        std::string lastPreparedQuery;
+
+        std::chrono::steady_clock::time_point startedAt {};
+        std::vector<std::pair<std::string_view, std::string>> binds;
+        size_t fetchRowCount {};
+    };
 
-    std::chrono::steady_clock::time_point _startedAt {};
-    std::vector<std::pair<std::string_view, std::string>> _binds;
-    size_t _fetchRowCount {};
+    static Context& ThisThread() noexcept
+    {
+        thread_local Context context {};
+        return context;
+    }
 
   public:
     SqlTraceLogger(SupportBindLogging supportBindLogging = SupportBindLogging::Yes):
@@ -127,37 +286,34 @@ class SqlTraceLogger: public SqlStandardLogger
     {
     }
 
+    // The error and its details are written as a single entry, so they are not interleaved with other threads' output.
     void OnError(SqlError error, std::source_location sourceLocation) override
     {
-        _state = State::Error;
-        SqlStandardLogger::OnError(error, sourceLocation);
-        WriteDetails(sourceLocation);
+        ThisThread().state = State::Error;
+        WriteMessage("SQL Error: {}\n{}", error, FormatDetails(sourceLocation));
     }
 
     void OnError(SqlErrorInfo const& errorInfo, std::source_location sourceLocation) override
     {
-        _state = State::Error;
-        SqlStandardLogger::OnError(errorInfo, sourceLocation);
-        WriteDetails(sourceLocation);
+        ThisThread().state = State::Error;
+        WriteMessage("{}\n{}", FormatError(errorInfo), FormatDetails(sourceLocation));
     }
 
     void OnConnectionOpened(SqlConnection const& connection) override
     {
-        _state = State::Idle;
-        Tick();
+        ThisThread().state = State::Idle;
         WriteMessage("Connection {} opened: {}", connection.ConnectionId(), connection.ConnectionString().Sanitized());
     }
 
     void OnConnectionClosed(SqlConnection const& connection) override
     {
-        _state = State::Idle;
-        Tick();
+        ThisThread().state = State::Idle;
         WriteMessage("Connection {} closed.", connection.ConnectionId());
     }
 
     void OnConnectionIdle(SqlConnection const& /*connection*/) override
     {
-        _state = State::Idle;
+        ThisThread().state = State::Idle;
         // nothing to log, for now
     }
 
@@ -168,89 +324,89 @@ class SqlTraceLogger: public SqlStandardLogger
 
     void OnPrepare(std::string_view const& query) override
     {
-        if (_state == State::Executing || _state == State::Fetching)
+        auto& context = ThisThread();
+        if (context.state == State::Executing || context.state == State::Fetching)
             OnFetchEnd();
 
-        _state = State::Preparing;
-        _lastPreparedQuery = query;
-        _startedAt = std::chrono::steady_clock::now();
+        context.state = State::Preparing;
+        context.lastPreparedQuery = query;
+        context.startedAt = std::chrono::steady_clock::now();
     }
 
     void OnBind(std::string_view const& name, std::string value) override
     {
-        _binds.emplace_back(name, std::move(value));
+        ThisThread().binds.emplace_back(name, std::move(value));
     }
 
     void OnExecuteDirect(std::string_view const& query) override
     {
-        if (_state == State::Executing || _state == State::Fetching)
+        auto& context = ThisThread();
+        if (context.state == State::Executing || context.state == State::Fetching)
             OnFetchEnd();
 
-        _state = State::Executing;
-        _lastPreparedQuery = query;
-        _startedAt = std::chrono::steady_clock::now();
+        context.state = State::Executing;
+        context.lastPreparedQuery = query;
+        context.startedAt = std::chrono::steady_clock::now();
     }
 
     void OnExecute(std::string_view const& query) override
     {
-        Tick();
-
-        if (_state == State::Executing)
+        auto& context = ThisThread();
+        if (context.state == State::Executing)
             OnFetchEnd();
 
-        _state = State::Executing;
-        _lastPreparedQuery = query;
-        _startedAt = std::chrono::steady_clock::now();
-        _fetchRowCount = 0;
+        context.state = State::Executing;
+        context.lastPreparedQuery = query;
+        context.startedAt = std::chrono::steady_clock::now();
+        context.fetchRowCount = 0;
     }
 
     void OnExecuteBatch() override
     {
-        Tick();
-        WriteMessage("ExecuteBatch: {}", _lastPreparedQuery);
-        _state = State::Executing;
-        _startedAt = std::chrono::steady_clock::now();
-        _fetchRowCount = 0;
+        auto& context = ThisThread();
+        WriteMessage("ExecuteBatch: {}", context.lastPreparedQuery);
+        context.state = State::Executing;
+        context.startedAt = std::chrono::steady_clock::now();
+        context.fetchRowCount = 0;
     }
 
     void OnFetchRow() override
     {
-        Tick();
-        _state = State::Fetching;
-        ++_fetchRowCount;
+        auto& context = ThisThread();
+        context.state = State::Fetching;
+        ++context.fetchRowCount;
     }
 
     void OnFetchEnd() override
     {
-        if (_state != State::Executing && _state != State::Fetching)
+        auto& context = ThisThread();
+        if (context.state != State::Executing && context.state != State::Fetching)
             return;
 
-        Tick();
-
         auto const stoppedAt = std::chrono::steady_clock::now();
-        auto const duration = std::chrono::duration_cast<std::chrono::microseconds>(stoppedAt - _startedAt);
+        auto const duration = std::chrono::duration_cast<std::chrono::microseconds>(stoppedAt - context.startedAt);
         auto const seconds = std::chrono::duration_cast<std::chrono::seconds>(duration);
         auto const microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration - seconds);
         auto const durationStr = std::format("{}.{:06}", seconds.count(), microseconds.count());
 
         auto const rowCountStr = [&]() -> std::string {
-            if (_fetchRowCount == 0)
+            if (context.fetchRowCount == 0)
                 return "";
-            if (_fetchRowCount == 1)
+            if (context.fetchRowCount == 1)
                 return " [1 row]";
-            return std::format(" [{} rows]", _fetchRowCount);
+            return std::format(" [{} rows]", context.fetchRowCount);
         }();
 
-        if (_binds.empty())
+        if (context.binds.empty())
         {
-            WriteMessage("[{}]{} {}", durationStr, rowCountStr, _lastPreparedQuery);
+            WriteMessage("[{}]{} {}", durationStr, rowCountStr, context.lastPreparedQuery);
         }
         else
         {
             std::stringstream output;
             size_t count = 0;
 
-            for (auto const& [name, value]: _binds)
+            for (auto const& [name, value]: context.binds)
             {
                 if (count)
                     output << ", ";
@@ -262,28 +418,30 @@ class SqlTraceLogger: public SqlStandardLogger
                     output << std::format("{}={}", name, value);
             }
 
-            WriteMessage("[{}]{} {} WITH [{}]", durationStr, rowCountStr, _lastPreparedQuery, output.str());
+            WriteMessage("[{}]{} {} WITH [{}]", durationStr, rowCountStr, context.lastPreparedQuery, output.str());
         }
 
-        _lastPreparedQuery.clear();
-        _state = State::Idle;
-        _fetchRowCount = 0;
-        _binds.clear();
+        context.lastPreparedQuery.clear();
+        context.state = State::Idle;
+        context.fetchRowCount = 0;
+        context.binds.clear();
     }
 
   private:
-    void WriteDetails(std::source_location sourceLocation)
+    static std::string FormatDetails(std::source_location sourceLocation)
     {
-        WriteMessage("  Source: {}:{}", sourceLocation.file_name(), sourceLocation.line());
-        if (!_lastPreparedQuery.empty())
-            WriteMessage("  Query: {}", _lastPreparedQuery);
-        WriteMessage("  Stack trace:");
+        auto details = std::format("  Source: {}:{}", sourceLocation.file_name(), sourceLocation.line());
+        if (auto const& query = ThisThread().lastPreparedQuery; !query.empty())
+            std::format_to(std::back_inserter(details), "\n  Query: {}", query);
+        details += "\n  Stack trace:";
 
 #if __has_include(<stacktrace>)
         auto stackTrace = std::stacktrace::current(1, 25);
         for (std::size_t const i: std::views::iota(std::size_t(0), stackTrace.size()))
-            WriteMessage("    [{:>2}] {}", i, stackTrace[i]);
+            std::format_to(std::back_inserter(details), "\n    [{:>2}] {}", i, stackTrace[i]);
 #endif
+
+        return details;
     }
 };
 
@@ -314,14 +472,18 @@ SqlLogger& SqlLogger::TraceLogger()
     return *theTraceLogger;
 }
 
-static SqlLogger* theDefaultLogger = &SqlLogger::NullLogger();
+static std::atomic<SqlLogger*> theDefaultLogger = &SqlLogger::NullLogger();
+
+std::atomic<std::underlying_type_t<SqlLogger::Event>> SqlLogger::_eventMask =
+    std::to_underlying(SqlLogger::Event::NONE);
 
 SqlLogger& SqlLogger::GetLogger()
 {
-    return *theDefaultLogger;
+    return *theDefaultLogger.load(std::memory_order_acquire);
 }
 
 void SqlLogger::SetLogger(SqlLogger& logger)
 {
-    theDefaultLogger = &logger;
+    theDefaultLogger.store(&logger, std::memory_order_release);
+    SetEventMask(&logger == &NullLogger() ? Event::NONE : Event::ALL);
 }
@@ -6,8 +6,16 @@
 #include "SqlDataBinder.hpp"
 #include "SqlError.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <source_location>
 #include <string_view>
+#include <type_traits>
+
+#if !defined(LIGHTWEIGHT_SQL_LOGGING)
+    /// Set to 0 (CMake option LIGHTWEIGHT_SQL_LOGGING=OFF) to compile out all logging hooks of the library.
+    #define LIGHTWEIGHT_SQL_LOGGING 1
+#endif
 
 class SqlConnection;
 
@@ -24,6 +32,20 @@ class LIGHTWEIGHT_API SqlLogger
         Yes
     };
 
+    /// The events a logger can be notified about, combinable to an event mask.
+    enum class Event : uint16_t
+    {
+        NONE = 0,
+        WARNINGS = 1 << 0,    ///< OnWarning()
+        ERRORS = 1 << 1,      ///< OnError()
+        CONNECTIONS = 1 << 2, ///< OnConnectionOpened(), OnConnectionClosed(), OnConnectionIdle(), OnConnectionReuse()
+        PREPARE = 1 << 3,     ///< OnPrepare()
+        EXECUTE = 1 << 4,     ///< OnExecuteDirect(), OnExecute(), OnExecuteBatch()
+        BIND = 1 << 5,        ///< OnBind(), including the formatting of the bound values
+        FETCH = 1 << 6,       ///< OnFetchRow(), OnFetchEnd()
+        ALL = 0x7F,
+    };
+
     SqlLogger() = default;
     SqlLogger(SqlLogger const& /*other*/) = default;
     SqlLogger(SqlLogger&& /*other*/) = default;
@@ -96,6 +118,12 @@ class LIGHTWEIGHT_API SqlLogger
     /// Invoked when fetching is done.
     virtual void OnFetchEnd() = 0;
 
+    /// Waits until all messages logged so far have been written.
+    ///
+    /// The standard and trace loggers format messages on the logging thread, but write them
+    /// on a background thread, in order to not stall the logging threads on console I/O.
+    virtual void Flush() {}
+
     class Null;
 
     /// Retrieves a null logger that does nothing.
@@ -113,12 +141,59 @@ class LIGHTWEIGHT_API SqlLogger
     /// Sets the current logger.
     ///
     /// The ownership of the logger is not transferred and remains with the caller.
+    /// This also resets the event mask, to Event::NONE for the null logger, and to Event::ALL otherwise.
     static void SetLogger(SqlLogger& logger);
 
+    /// Sets the events the current logger is notified about.
+    ///
+    /// Events not in the mask are filtered out before any virtual dispatch or argument formatting,
+    /// e.g. to only log errors and warnings, without paying for the per-row fetch hooks.
+    static void SetEventMask(Event mask) noexcept
+    {
+        _eventMask.store(std::to_underlying(mask), std::memory_order_relaxed);
+    }
+
+    /// Retrieves the events the current logger is notified about.
+    [[nodiscard]] static Event GetEventMask() noexcept
+    {
+        return static_cast<Event>(_eventMask.load(std::memory_order_relaxed));
+    }
+
+    /// Tests whether the current logger is to be notified about any of the given events.
+    ///
+    /// This is checked by the library before invoking any logger hook, and always yields false
+    /// if the hooks are compiled out (LIGHTWEIGHT_SQL_LOGGING=0).
+    [[nodiscard]] static bool IsEnabled(Event event) noexcept
+    {
+#if LIGHTWEIGHT_SQL_LOGGING
+        return (_eventMask.load(std::memory_order_relaxed) & std::to_underlying(event)) != 0;
+#else
+        (void) event;
+        return false;
+#endif
+    }
+
   private:
     bool _supportsBindLogging = false;
+
+    static std::atomic<std::underlying_type_t<Event>> _eventMask;
 };
 
+constexpr SqlLogger::Event operator|(SqlLogger::Event lhs, SqlLogger::Event rhs) noexcept
+{
+    return static_cast<SqlLogger::Event>(std::to_underlying(lhs) | std::to_underlying(rhs));
+}
+
+constexpr SqlLogger::Event operator&(SqlLogger::Event lhs, SqlLogger::Event rhs) noexcept
+{
+    return static_cast<SqlLogger::Event>(std::to_underlying(lhs) & std::to_underlying(rhs));
+}
+
+constexpr SqlLogger::Event operator~(SqlLogger::Event event) noexcept
+{
+    return static_cast<SqlLogger::Event>(~std::to_underlying(event) & std::to_underlying(SqlLogger::Event::ALL));
+}
+
 class SqlLogger::Null: public SqlLogger
 {
   public:
@@ -41,6 +41,11 @@ SqlDeleteQueryBuilder SqlQueryBuilder::Delete() noexcept
     return SqlDeleteQueryBuilder(m_formatter, std::move(m_table), std::move(m_tableAlias));
 }
 
+SqlUpsertQueryBuilder SqlQueryBuilder::Upsert(std::vector<SqlVariant>* boundInputs) noexcept
+{
+    return SqlUpsertQueryBuilder(m_formatter, std::move(m_table), boundInputs);
+}
+
 SqlMigrationQueryBuilder SqlQueryBuilder::Migration()
 {
     return SqlMigrationQueryBuilder(m_formatter);
@@ -7,6 +7,7 @@
 #include "SqlQuery/Migrate.hpp"
 #include "SqlQuery/Select.hpp"
 #include "SqlQuery/Update.hpp"
+#include "SqlQuery/Upsert.hpp"
 
 struct [[nodiscard]] SqlLastInsertIdQuery
 {
@@ -67,6 +68,15 @@ class [[nodiscard]] SqlQueryBuilder final
     /// Initiates DELETE query building.
     LIGHTWEIGHT_API SqlDeleteQueryBuilder Delete() noexcept;
 
+    /// Initiates UPSERT query building, inserting a row or updating it if it already exists.
+    ///
+    /// @param boundInputs Optional vector to store bound inputs.
+    ///                    If provided, the inputs will be appended to this vector and can be used
+    ///                    to bind the values to the query via SqlStatement::ExecuteWithVariants(...)
+    ///
+    /// @see SqlUpsertQueryBuilder
+    LIGHTWEIGHT_API SqlUpsertQueryBuilder Upsert(std::vector<SqlVariant>* boundInputs = nullptr) noexcept;
+
     /// Initiates query for building database migrations.
     LIGHTWEIGHT_API SqlMigrationQueryBuilder Migration();
 
@@ -5,12 +5,27 @@
 #include "Core.hpp"
 
 #include <cassert>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
 
 /// @brief Query builder for building INSERT INTO ... queries.
 ///
+/// Multiple rows can be inserted with a single query by calling NextRow() between the rows,
+/// where each row must set the same columns in the same order as the first row.
+///
+/// @code
+/// auto const sql = connection.Query("Employee")
+///                      .Insert()
+///                      .Set("name", "Alice")
+///                      .Set("salary", 42)
+///                      .NextRow()
+///                      .Set("name", "Bob")
+///                      .Set("salary", 43)
+///                      .ToSql();
+/// @endcode
+///
 /// @see SqlQueryBuilder
 /// @ingroup QueryBuilder
 class [[nodiscard]] SqlInsertQueryBuilder final
@@ -31,14 +46,23 @@ class [[nodiscard]] SqlInsertQueryBuilder final
     // Adds a single column to the INSERT query with the value being a MFC like CString.
     inline SqlInsertQueryBuilder& Set(std::string_view columnName, MFCStringLike auto const* value);
 
+    // Starts another row of values to be inserted, with the same columns as the first row.
+    LIGHTWEIGHT_API SqlInsertQueryBuilder& NextRow();
+
     // Finalizes building the query as INSERT INTO ... query.
     [[nodiscard]] LIGHTWEIGHT_API std::string ToSql() const;
 
+    // Finalizes building the query as INSERT INTO ... query that also yields the value generated
+    // for the given column of each inserted row, or std::nullopt if the SQL dialect does not support this.
+    [[nodiscard]] LIGHTWEIGHT_API std::optional<std::string> ToSqlReturning(std::string_view returningColumn) const;
+
   private:
     SqlQueryFormatter const& m_formatter;
     std::string m_tableName;
     std::string m_fields;
-    std::string m_values;
+    std::size_t m_columnCount = 0;    // The number of columns set in the first row.
+    std::size_t m_rowColumnCount = 0; // The number of columns set in the row currently being built.
+    std::vector<std::string> m_rows;  // The values of each row, the last one being currently built.
     std::vector<SqlVariant>* m_inputBindings;
 };
 
@@ -50,44 +74,74 @@ inline LIGHTWEIGHT_FORCE_INLINE SqlInsertQueryBuilder::SqlInsertQueryBuilder(
 {
 }
 
+namespace detail
+{
+
+// Appends the SQL value expression of a column value to be inserted.
+//
+// The value is rendered as literal, unless it is bound as input parameter (wildcard or input bindings given).
 template <typename ColumnValue>
-SqlInsertQueryBuilder& SqlInsertQueryBuilder::Set(std::string_view columnName, ColumnValue const& value)
+void AppendInsertValue(std::string& sql,
+                       SqlQueryFormatter const& formatter,
+                       std::vector<SqlVariant>* inputBindings,
+                       ColumnValue const& value)
 {
     using namespace std::string_view_literals;
 
-    if (!m_fields.empty())
-        m_fields += ", "sv;
-
-    m_fields += '"';
-    m_fields += columnName;
-    m_fields += '"';
-
-    if (!m_values.empty())
-        m_values += ", "sv;
-
     if constexpr (std::is_same_v<ColumnValue, SqlNullType>)
-        m_values += "NULL"sv;
+        sql += "NULL"sv;
     else if constexpr (std::is_same_v<ColumnValue, SqlWildcardType>)
-        m_values += '?';
-    else if (m_inputBindings)
+        sql += '?';
+    else if (inputBindings)
     {
-        m_values += '?';
-        m_inputBindings->emplace_back(value);
+        sql += '?';
+        inputBindings->emplace_back(value);
     }
     else if constexpr (std::is_same_v<ColumnValue, char>)
-        m_values += m_formatter.StringLiteral(value);
+        sql += formatter.StringLiteral(value);
     else if constexpr (std::is_arithmetic_v<ColumnValue>)
-        m_values += std::format("{}", value);
+        sql += std::format("{}", value);
     else if constexpr (std::is_convertible_v<ColumnValue, std::string>
                        || std::is_convertible_v<ColumnValue, std::string_view>
                        || std::is_convertible_v<ColumnValue, char const*>)
     {
-        m_values += m_formatter.StringLiteral(value);
+        sql += formatter.StringLiteral(value);
     }
     else
     {
-        m_values += m_formatter.StringLiteral(std::format("{}", value));
+        sql += formatter.StringLiteral(std::format("{}", value));
+    }
+}
+
+} // namespace detail
+
+template <typename ColumnValue>
+SqlInsertQueryBuilder& SqlInsertQueryBuilder::Set(std::string_view columnName, ColumnValue const& value)
+{
+    using namespace std::string_view_literals;
+
+    if (m_rows.empty())
+        m_rows.emplace_back();
+
+    if (m_rows.size() == 1)
+    {
+        if (!m_fields.empty())
+            m_fields += ", "sv;
+
+        m_fields += '"';
+        m_fields += columnName;
+        m_fields += '"';
+        ++m_columnCount;
     }
+    else
+        assert(m_rowColumnCount < m_columnCount && "All rows must set the same columns as the first row");
+    ++m_rowColumnCount;
+
+    auto& values = m_rows.back();
+    if (!values.empty())
+        values += ", "sv;
+
+    detail::AppendInsertValue(values, m_formatter, m_inputBindings, value);
 
     return *this;
 }
@@ -103,7 +157,25 @@ inline SqlInsertQueryBuilder& SqlInsertQueryBuilder::Set(std::string_view column
     return Set(columnName, std::string_view { value->GetString(), value->GetLength() });
 }
 
+inline SqlInsertQueryBuilder& SqlInsertQueryBuilder::NextRow()
+{
+    assert(!m_rows.empty() && m_rowColumnCount == m_columnCount
+           && "All rows must set the same columns as the first row");
+
+    m_rows.emplace_back();
+    m_rowColumnCount = 0;
+    return *this;
+}
+
 inline std::string SqlInsertQueryBuilder::ToSql() const
 {
-    return m_formatter.Insert(m_tableName, m_fields, m_values);
+    if (m_rows.size() > 1)
+        return m_formatter.InsertRows(m_tableName, m_fields, m_rows);
+
+    return m_formatter.Insert(m_tableName, m_fields, m_rows.empty() ? std::string {} : m_rows.front());
+}
+
+inline std::optional<std::string> SqlInsertQueryBuilder::ToSqlReturning(std::string_view returningColumn) const
+{
+    return m_formatter.InsertRowsReturning(m_tableName, m_fields, m_rows, returningColumn);
 }
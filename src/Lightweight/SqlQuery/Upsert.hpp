@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core.hpp"
+#include "Insert.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Query builder for building queries that insert a row, or update it if it already exists.
+///
+/// The row is identified by its key columns, which must be covered by a primary key or unique constraint.
+/// If a row with the same key values exists, all other columns are updated, otherwise the row is inserted.
+/// This is rendered as `INSERT ... ON CONFLICT` (SQLite, PostgreSQL) or `MERGE` (SQL Server, Oracle).
+///
+/// Input parameters are always bound in the order the columns were added, regardless of the SQL dialect.
+///
+/// @code
+/// auto const sql = connection.Query("Employee")
+///                      .Upsert()
+///                      .Key("id", SqlWildcard)
+///                      .Set("name", SqlWildcard)
+///                      .ToSql();
+/// @endcode
+///
+/// @see SqlQueryBuilder
+/// @ingroup QueryBuilder
+class [[nodiscard]] SqlUpsertQueryBuilder final
+{
+  public:
+    explicit SqlUpsertQueryBuilder(SqlQueryFormatter const& formatter,
+                                   std::string tableName,
+                                   std::vector<SqlVariant>* inputBindings) noexcept;
+
+    // Adds a key column to the UPSERT query, identifying the row to be updated if it already exists.
+    template <typename ColumnValue>
+    SqlUpsertQueryBuilder& Key(std::string_view columnName, ColumnValue const& value);
+
+    // Adds a single column to the UPSERT query, being inserted or updated.
+    template <typename ColumnValue>
+    SqlUpsertQueryBuilder& Set(std::string_view columnName, ColumnValue const& value);
+
+    // Adds a single column to the UPSERT query with the value being a string literal.
+    template <std::size_t N>
+    SqlUpsertQueryBuilder& Set(std::string_view columnName, char const (&value)[N]);
+
+    // Finalizes building the query as INSERT ... ON CONFLICT or MERGE query, depending on the SQL dialect.
+    [[nodiscard]] LIGHTWEIGHT_API std::string ToSql() const;
+
+  private:
+    SqlQueryFormatter const& m_formatter;
+    std::string m_tableName;
+    std::vector<std::string> m_columns;
+    std::vector<std::string> m_values;
+    std::vector<std::string> m_keyColumns;
+    std::vector<SqlVariant>* m_inputBindings;
+};
+
+inline LIGHTWEIGHT_FORCE_INLINE SqlUpsertQueryBuilder::SqlUpsertQueryBuilder(
+    SqlQueryFormatter const& formatter, std::string tableName, std::vector<SqlVariant>* inputBindings) noexcept:
+    m_formatter { formatter },
+    m_tableName { std::move(tableName) },
+    m_inputBindings { inputBindings }
+{
+}
+
+template <typename ColumnValue>
+SqlUpsertQueryBuilder& SqlUpsertQueryBuilder::Key(std::string_view columnName, ColumnValue const& value)
+{
+    m_keyColumns.emplace_back(columnName);
+    return Set(columnName, value);
+}
+
+template <typename ColumnValue>
+SqlUpsertQueryBuilder& SqlUpsertQueryBuilder::Set(std::string_view columnName, ColumnValue const& value)
+{
+    m_columns.emplace_back(columnName);
+    detail::AppendInsertValue(m_values.emplace_back(), m_formatter, m_inputBindings, value);
+    return *this;
+}
+
+template <std::size_t N>
+inline SqlUpsertQueryBuilder& SqlUpsertQueryBuilder::Set(std::string_view columnName, char const (&value)[N])
+{
+    return Set(columnName, std::string_view { value, N - 1 });
+}
+
+inline std::string SqlUpsertQueryBuilder::ToSql() const
+{
+    return m_formatter.Upsert(m_tableName, m_columns, m_values, m_keyColumns);
+}
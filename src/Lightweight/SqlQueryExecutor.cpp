@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SqlQueryExecutor.hpp"
+
+#include <stdexcept>
+
+SqlQueryExecutor::SqlQueryExecutor(SqlConnectionPool& pool, SqlQueryExecutorConfig config):
+    m_pool { pool },
+    m_config { std::move(config) }
+{
+    if (m_config.concurrency == 0)
+        throw std::invalid_argument { "The concurrency must not be zero" };
+
+    if (m_config.queueCapacity == 0)
+        throw std::invalid_argument { "The queue capacity must not be zero" };
+
+    m_workers.reserve(m_config.concurrency);
+    for (std::size_t i = 0; i < m_config.concurrency; ++i)
+        m_workers.emplace_back([this] { Work(); });
+}
+
+SqlQueryExecutor::~SqlQueryExecutor()
+{
+    {
+        auto const lock = std::scoped_lock { m_mutex };
+        m_stopping = true;
+    }
+    m_jobQueued.notify_all();
+    m_workers.clear(); // Joins the workers, once they have drained the queue
+}
+
+std::size_t SqlQueryExecutor::QueuedCount() const
+{
+    auto const lock = std::scoped_lock { m_mutex };
+    return m_jobs.size();
+}
+
+void SqlQueryExecutor::Enqueue(Job job)
+{
+    {
+        auto lock = std::unique_lock { m_mutex };
+        m_jobTaken.wait(lock, [this] { return m_jobs.size() < m_config.queueCapacity; });
+        m_jobs.emplace_back(std::move(job));
+    }
+    m_jobQueued.notify_one();
+}
+
+void SqlQueryExecutor::Work()
+{
+    while (true)
+    {
+        auto job = Job {};
+        {
+            auto lock = std::unique_lock { m_mutex };
+            m_jobQueued.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+            if (m_jobs.empty())
+                return; // Stopping, and all queued jobs have been executed
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        m_jobTaken.notify_one();
+
+        // Exceptions are captured by the job's std::packaged_task, and delivered via its future.
+        job();
+    }
+}
+
+SqlConnection SqlQueryExecutor::AcquireConnection()
+{
+    return m_config.connectionString ? m_pool.Acquire(*m_config.connectionString) : m_pool.Acquire();
+}
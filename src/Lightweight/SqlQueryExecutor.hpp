@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Api.hpp"
+#include "SqlConnectInfo.hpp"
+#include "SqlConnection.hpp"
+#include "SqlConnectionPool.hpp"
+
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @brief Configures the behaviour of a SqlQueryExecutor.
+struct SqlQueryExecutorConfig
+{
+    /// Number of queries executed concurrently, each on its own worker thread and pooled connection.
+    std::size_t concurrency = 4;
+
+    /// Maximum number of queries waiting for execution. Submitting more blocks until a worker has picked one up.
+    std::size_t queueCapacity = 256;
+
+    /// Connection string to acquire the connections for, or std::nullopt to use the default connection string.
+    std::optional<SqlConnectionString> connectionString;
+};
+
+/// @brief Executes independent queries concurrently, distributed over connections of a SqlConnectionPool.
+///
+/// Each submitted query is a callable receiving a SqlConnection, acquired from the pool for the duration of
+/// the call. Queries are queued in a bounded queue and executed by a fixed number of worker threads,
+/// and their results (or exceptions) are delivered via std::future.
+///
+/// This allows fanning out many independent reads (e.g. loading the HasMany relations of many records)
+/// in parallel, instead of executing them one after another on a single connection.
+///
+/// @note The pool must outlive the executor, and should permit at least as many connections as workers.
+///
+/// @code
+/// auto executor = SqlQueryExecutor { pool, { .concurrency = 8 } };
+/// auto futures = std::vector<std::future<std::vector<Order>>> {};
+/// for (auto const& customer: customers)
+///     futures.emplace_back(executor.Submit([id = customer.id.Value()](SqlConnection& connection) {
+///         auto dm = DataMapper { std::move(connection) };
+///         return dm.Query<Order>().Where("customer_id", "=", id).All();
+///     }));
+/// for (auto& future: futures)
+///     Report(future.get());
+/// @endcode
+class LIGHTWEIGHT_API SqlQueryExecutor final
+{
+  public:
+    /// Constructs the executor and starts its worker threads.
+    ///
+    /// @throws std::invalid_argument if the concurrency or the queue capacity is zero.
+    explicit SqlQueryExecutor(SqlConnectionPool& pool, SqlQueryExecutorConfig config = {});
+
+    SqlQueryExecutor(SqlQueryExecutor&&) = delete;
+    SqlQueryExecutor(SqlQueryExecutor const&) = delete;
+    SqlQueryExecutor& operator=(SqlQueryExecutor&&) = delete;
+    SqlQueryExecutor& operator=(SqlQueryExecutor const&) = delete;
+
+    /// Executes all queries still queued, and stops the worker threads.
+    ~SqlQueryExecutor();
+
+    /// Queues the given query for execution, blocking while the queue is full.
+    ///
+    /// The query is invoked as `query(connection)` on one of the worker threads. It may take over the
+    /// connection (e.g. by moving it into a DataMapper), in which case it is returned to the pool once
+    /// the new owner is destroyed.
+    ///
+    /// @return A future receiving the result of the query, or the exception it (or acquiring the connection) threw.
+    template <typename Query>
+        requires std::invocable<Query&, SqlConnection&>
+    [[nodiscard]] std::future<std::invoke_result_t<Query&, SqlConnection&>> Submit(Query query);
+
+    /// Retrieves the number of queries waiting for execution.
+    [[nodiscard]] std::size_t QueuedCount() const;
+
+    /// Retrieves the executor configuration.
+    [[nodiscard]] SqlQueryExecutorConfig const& Config() const noexcept
+    {
+        return m_config;
+    }
+
+  private:
+    using Job = std::move_only_function<void()>;
+
+    void Enqueue(Job job);
+    void Work();
+    [[nodiscard]] SqlConnection AcquireConnection();
+
+    SqlConnectionPool& m_pool;
+    SqlQueryExecutorConfig m_config;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_jobQueued;
+    std::condition_variable m_jobTaken;
+    std::deque<Job> m_jobs;
+    bool m_stopping = false;
+    std::vector<std::jthread> m_workers;
+};
+
+template <typename Query>
+    requires std::invocable<Query&, SqlConnection&>
+std::future<std::invoke_result_t<Query&, SqlConnection&>> SqlQueryExecutor::Submit(Query query)
+{
+    using Result = std::invoke_result_t<Query&, SqlConnection&>;
+
+    auto task = std::packaged_task<Result()> { [this, query = std::move(query)]() mutable -> Result {
+        auto connection = AcquireConnection();
+        return std::invoke(query, connection);
+    } };
+    auto future = task.get_future();
+    Enqueue(std::move(task));
+    return future;
+}
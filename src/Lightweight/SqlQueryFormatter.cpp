@@ -5,9 +5,12 @@
 
 #include <reflection-cpp/reflection.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <concepts>
 #include <format>
+#include <functional>
+#include <ranges>
 #include <type_traits>
 
 using namespace std::string_view_literals;
@@ -20,6 +23,33 @@ class PostgreSqlFormatter;
 class SqlServerQueryFormatter;
 class OracleSqlQueryFormatter;
 
+// Joins the given items, each formatted by the given callable, separated by the given separator.
+template <typename Items, typename Format>
+std::string JoinColumns(Items&& items, std::string_view separator, Format const& format)
+{
+    auto result = std::string {};
+    for (auto const& item: items)
+    {
+        if (!result.empty())
+            result += separator;
+        result += format(item);
+    }
+    return result;
+}
+
+std::string Quoted(std::string_view column)
+{
+    return std::format(R"("{}")", column);
+}
+
+// Retrieves the columns (of an UPSERT) that are not key columns, i.e. the ones to update.
+auto NonKeyColumns(std::vector<std::string> const& columns, std::vector<std::string> const& keyColumns)
+{
+    return columns | std::views::filter([&keyColumns](std::string const& column) {
+               return !std::ranges::contains(keyColumns, column);
+           });
+}
+
 class BasicSqlQueryFormatter: public SqlQueryFormatter
 {
   public:
@@ -30,12 +60,49 @@ class BasicSqlQueryFormatter: public SqlQueryFormatter
         return std::format(R"(INSERT INTO "{}" ({}) VALUES ({}))", intoTable, fields, values);
     }
 
+    [[nodiscard]] std::string InsertRows(std::string const& intoTable,
+                                         std::string const& fields,
+                                         std::vector<std::string> const& rows) const override
+    {
+        return std::format(R"(INSERT INTO "{}" ({}) VALUES {})",
+                           intoTable,
+                           fields,
+                           JoinColumns(rows, ", "sv, [](auto const& row) { return std::format("({})", row); }));
+    }
+
+    [[nodiscard]] std::string Upsert(std::string const& intoTable,
+                                     std::vector<std::string> const& columns,
+                                     std::vector<std::string> const& values,
+                                     std::vector<std::string> const& keyColumns) const override
+    {
+        // This is SQLite and PostgreSQL syntax.
+        auto const updates = JoinColumns(NonKeyColumns(columns, keyColumns), ", "sv, [](auto const& column) {
+            return std::format(R"("{0}" = excluded."{0}")", column);
+        });
+
+        return std::format(R"(INSERT INTO "{}" ({}) VALUES ({}) ON CONFLICT ({}) DO {})",
+                           intoTable,
+                           JoinColumns(columns, ", "sv, Quoted),
+                           JoinColumns(values, ", "sv, std::identity {}),
+                           JoinColumns(keyColumns, ", "sv, Quoted),
+                           updates.empty() ? std::string { "NOTHING" } : "UPDATE SET " + updates);
+    }
+
     [[nodiscard]] std::string QueryLastInsertId(std::string_view /*tableName*/) const override
     {
         // This is SQLite syntax. We might want to provide aspecialized SQLite class instead.
         return "SELECT LAST_INSERT_ROWID()";
     }
 
+    [[nodiscard]] std::optional<std::string> InsertRowsReturning(std::string const& intoTable,
+                                                                 std::string const& fields,
+                                                                 std::vector<std::string> const& rows,
+                                                                 std::string_view returningColumn) const override
+    {
+        // This is SQLite (3.35+) and PostgreSQL syntax.
+        return std::format(R"({} RETURNING "{}")", InsertRows(intoTable, fields, rows), returningColumn);
+    }
+
     [[nodiscard]] std::string_view BooleanLiteral(bool literalValue) const noexcept override
     {
         return literalValue ? "TRUE"sv : "FALSE"sv;
@@ -389,6 +456,55 @@ class SqlServerQueryFormatter final: public BasicSqlQueryFormatter
         return std::format("SELECT @@IDENTITY");
     }
 
+    [[nodiscard]] std::optional<std::string> InsertRowsReturning(std::string const& intoTable,
+                                                                 std::string const& fields,
+                                                                 std::vector<std::string> const& rows,
+                                                                 std::string_view returningColumn) const override
+    {
+        // Identity values are only guaranteed to be generated in row order for INSERT ... SELECT ... ORDER BY,
+        // so the rows are numbered and selected in order.
+        auto numberedRows = std::string {};
+        for (auto const& [index, row]: rows | std::views::enumerate)
+            numberedRows += std::format("{}({}, {})", index == 0 ? ""sv : ", "sv, row, index);
+
+        return std::format(R"(INSERT INTO "{0}" ({1}) OUTPUT INSERTED."{2}" SELECT {1} FROM (VALUES {3}))"
+                           R"( AS "_Rows" ({1}, "_RowIndex") ORDER BY "_RowIndex")",
+                           intoTable,
+                           fields,
+                           returningColumn,
+                           numberedRows);
+    }
+
+    [[nodiscard]] std::string Upsert(std::string const& intoTable,
+                                     std::vector<std::string> const& columns,
+                                     std::vector<std::string> const& values,
+                                     std::vector<std::string> const& keyColumns) const override
+    {
+        // HOLDLOCK makes the MERGE atomic, otherwise concurrent upserts of the same key may both try to insert.
+        auto sql = std::format(R"(MERGE INTO "{}" WITH (HOLDLOCK) AS target USING (VALUES ({})) AS source ({}) ON {})",
+                               intoTable,
+                               JoinColumns(values, ", "sv, std::identity {}),
+                               JoinColumns(columns, ", "sv, Quoted),
+                               JoinColumns(keyColumns, " AND "sv, [](auto const& column) {
+                                   return std::format(R"(target."{0}" = source."{0}")", column);
+                               }));
+
+        if (auto const updates = JoinColumns(NonKeyColumns(columns, keyColumns),
+                                             ", "sv,
+                                             [](auto const& column) {
+                                                 return std::format(R"("{0}" = source."{0}")", column);
+                                             });
+            !updates.empty())
+            sql += std::format(" WHEN MATCHED THEN UPDATE SET {}", updates);
+
+        sql += std::format(" WHEN NOT MATCHED THEN INSERT ({}) VALUES ({});",
+                           JoinColumns(columns, ", "sv, Quoted),
+                           JoinColumns(columns, ", "sv, [](auto const& column) {
+                               return std::format(R"(source."{}")", column);
+                           }));
+        return sql;
+    }
+
     [[nodiscard]] std::string_view BooleanLiteral(bool literalValue) const noexcept override
     {
         return literalValue ? "1"sv : "0"sv;
@@ -553,6 +669,60 @@ class OracleSqlQueryFormatter final: public BasicSqlQueryFormatter
         return std::format("SELECT \"{}_SEQ\".CURRVAL FROM DUAL;", tableName);
     }
 
+    [[nodiscard]] std::optional<std::string> InsertRowsReturning(std::string const& /*intoTable*/,
+                                                                 std::string const& /*fields*/,
+                                                                 std::vector<std::string> const& /*rows*/,
+                                                                 std::string_view /*returningColumn*/) const override
+    {
+        // Oracle only returns generated values into output parameters (RETURNING ... INTO), one row at a time.
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::string InsertRows(std::string const& intoTable,
+                                         std::string const& fields,
+                                         std::vector<std::string> const& rows) const override
+    {
+        // Oracle does not support multiple rows in a VALUES clause, so we select them from DUAL instead.
+        return std::format(R"(INSERT INTO "{}" ({}) {})",
+                           intoTable,
+                           fields,
+                           JoinColumns(rows, " UNION ALL "sv, [](auto const& row) {
+                               return std::format("SELECT {} FROM DUAL", row);
+                           }));
+    }
+
+    [[nodiscard]] std::string Upsert(std::string const& intoTable,
+                                     std::vector<std::string> const& columns,
+                                     std::vector<std::string> const& values,
+                                     std::vector<std::string> const& keyColumns) const override
+    {
+        auto sourceColumns = std::string {};
+        for (auto const& [column, value]: std::views::zip(columns, values))
+            sourceColumns += std::format(R"({}{} AS "{}")", sourceColumns.empty() ? ""sv : ", "sv, value, column);
+
+        auto sql = std::format(R"(MERGE INTO "{}" target USING (SELECT {} FROM DUAL) source ON ({}))",
+                               intoTable,
+                               sourceColumns,
+                               JoinColumns(keyColumns, " AND "sv, [](auto const& column) {
+                                   return std::format(R"(target."{0}" = source."{0}")", column);
+                               }));
+
+        if (auto const updates = JoinColumns(NonKeyColumns(columns, keyColumns),
+                                             ", "sv,
+                                             [](auto const& column) {
+                                                 return std::format(R"(target."{0}" = source."{0}")", column);
+                                             });
+            !updates.empty())
+            sql += std::format(" WHEN MATCHED THEN UPDATE SET {}", updates);
+
+        sql += std::format(" WHEN NOT MATCHED THEN INSERT ({}) VALUES ({})",
+                           JoinColumns(columns, ", "sv, Quoted),
+                           JoinColumns(columns, ", "sv, [](auto const& column) {
+                               return std::format(R"(source."{}")", column);
+                           }));
+        return sql;
+    }
+
     [[nodiscard]] std::string_view BooleanLiteral(bool literalValue) const noexcept override
     {
         return literalValue ? "1"sv : "0"sv;
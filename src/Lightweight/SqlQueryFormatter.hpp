@@ -6,8 +6,11 @@
 #include "SqlConnection.hpp"
 #include "SqlQuery/MigrationPlan.hpp"
 
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 struct SqlQualifiedTableColumnName;
 
@@ -42,9 +45,44 @@ class [[nodiscard]] LIGHTWEIGHT_API SqlQueryFormatter
                                              std::string const& fields,
                                              std::string const& values) const = 0;
 
+    /// Constructs an SQL INSERT query that inserts multiple rows at once.
+    ///
+    /// @param intoTable The table to insert into.
+    /// @param fields The fields to insert into.
+    /// @param rows The values of each row to insert, each in the same order as the fields.
+    [[nodiscard]] virtual std::string InsertRows(std::string const& intoTable,
+                                                 std::string const& fields,
+                                                 std::vector<std::string> const& rows) const = 0;
+
+    /// Constructs an SQL query that inserts a row, or updates the existing row with the same key column values.
+    ///
+    /// @param intoTable The table to insert into.
+    /// @param columns The columns to insert into.
+    /// @param values The values to insert, in the same order as the columns.
+    /// @param keyColumns The subset of columns identifying an existing row.
+    ///
+    /// All columns that are not key columns are updated if the row already exists.
+    /// The values are referenced in the order of the columns, such that input parameters bind the same way
+    /// for all dialects.
+    [[nodiscard]] virtual std::string Upsert(std::string const& intoTable,
+                                             std::vector<std::string> const& columns,
+                                             std::vector<std::string> const& values,
+                                             std::vector<std::string> const& keyColumns) const = 0;
+
     /// Retrieves the last insert ID of the given table.
     [[nodiscard]] virtual std::string QueryLastInsertId(std::string_view tableName) const = 0;
 
+    /// Constructs an SQL INSERT query that inserts multiple rows at once, and yields the value generated
+    /// by the server for @p returningColumn (e.g. an auto-incremented primary key) of each inserted row.
+    ///
+    /// The values are generated in the order of the rows, but may be yielded in any order.
+    ///
+    /// @return The query, or std::nullopt if the dialect cannot return generated values from an INSERT.
+    [[nodiscard]] virtual std::optional<std::string> InsertRowsReturning(std::string const& intoTable,
+                                                                         std::string const& fields,
+                                                                         std::vector<std::string> const& rows,
+                                                                         std::string_view returningColumn) const = 0;
+
     /// Constructs an SQL SELECT query for all rows.
     [[nodiscard]] virtual std::string SelectAll(bool distinct,
                                                 std::string const& fields,
@@ -3,12 +3,20 @@
 #include "SqlQuery.hpp"
 #include "SqlStatement.hpp"
 
+#include <new>
+
 struct SqlStatement::Data
 {
     std::optional<SqlConnection> ownedConnection; // The connection object (if owned)
     std::vector<SQLLEN> indicators;               // Holds the indicators for the bound output columns
     std::vector<std::function<void()>> postExecuteCallbacks;
-    std::vector<std::function<void()>> postProcessOutputColumnCallbacks;
+    std::vector<SqlOutputColumnFixup> outputColumnFixups; // Applied to every fetched row of the bound output columns
+    std::vector<SQLLEN> blockIndicators; // Holds the indicators for the columns bound by FetchRows()/FetchRowsInto()
+    std::size_t blockRowCount {};        // Number of rows per block fetch, or 0 if not in block fetch mode
+    std::size_t blockRowStride {};       // Indicators per row for row-wise binding, or 0 for column-wise binding
+    SQLULEN rowsFetched {};              // Number of rows fetched by the last FetchRows() call
+    std::vector<std::vector<std::byte>> columnBuffers; // Reused buffers of GetColumnView(), indexed by column
+    std::optional<std::vector<SqlColumnMetadata>> columns; // The described result columns, if described yet
 
     static Data const NoData;
 };
@@ -17,13 +25,55 @@ SqlStatement::Data const SqlStatement::Data::NoData {};
 
 static auto MakeUnexpected(SqlErrorInfo info, std::source_location location)
 {
-    SqlLogger::GetLogger().OnError(info, location);
+    if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+        SqlLogger::GetLogger().OnError(info, location);
     return std::unexpected { std::move(info) };
 }
 
+[[noreturn]] static void ThrowFetchError(SqlErrorInfo errorInfo)
+{
+    if (errorInfo.sqlState == "07009")
+        throw std::invalid_argument(std::format("SQL error: {}", errorInfo));
+    else
+        throw SqlException(std::move(errorInfo));
+}
+
+namespace
+{
+
+// Enables asynchronous execution (polling mode) of the statement for the lifetime of the scope.
+// Drivers not supporting it reject the attribute, and simply execute synchronously.
+class AsyncExecutionScope final
+{
+  public:
+    explicit AsyncExecutionScope(SQLHSTMT hStmt) noexcept:
+        m_hStmt { hStmt },
+        m_enabled { SQL_SUCCEEDED(
+            SQLSetStmtAttr(hStmt, SQL_ATTR_ASYNC_ENABLE, (SQLPOINTER) SQL_ASYNC_ENABLE_ON, SQL_IS_UINTEGER)) }
+    {
+    }
+
+    AsyncExecutionScope(AsyncExecutionScope&&) = delete;
+    AsyncExecutionScope(AsyncExecutionScope const&) = delete;
+    AsyncExecutionScope& operator=(AsyncExecutionScope&&) = delete;
+    AsyncExecutionScope& operator=(AsyncExecutionScope const&) = delete;
+
+    ~AsyncExecutionScope()
+    {
+        if (m_enabled)
+            SQLSetStmtAttr(m_hStmt, SQL_ATTR_ASYNC_ENABLE, (SQLPOINTER) SQL_ASYNC_ENABLE_OFF, SQL_IS_UINTEGER);
+    }
+
+  private:
+    SQLHSTMT m_hStmt;
+    bool m_enabled;
+};
+
+} // namespace
+
 void SqlStatement::RequireIndicators()
 {
-    auto const count = NumColumnsAffected() + 1;
+    auto const count = DescribeColumns().size() + 1;
     if (m_data->indicators.size() <= count)
         m_data->indicators.resize(count + 1);
 }
@@ -45,9 +95,41 @@ void SqlStatement::ProcessPostExecuteCallbacks()
     m_data->postExecuteCallbacks.clear();
 }
 
-void SqlStatement::PlanPostProcessOutputColumn(std::function<void()>&& cb)
+SQLRETURN SqlStatement::PutDataAtExecution()
+{
+    // SQLParamData() hands back the token of each data-at-execution parameter, i.e. its SqlInputStream.
+    SQLPOINTER token {};
+    SQLRETURN result {};
+    while ((result = SQLParamData(m_hStmt, &token)) == SQL_NEED_DATA)
+    {
+        try
+        {
+            RequireSuccess(SqlDataBinder<SqlInputStream>::PutData(m_hStmt, *static_cast<SqlInputStream const*>(token)));
+        }
+        catch (...)
+        {
+            // Leave the data-at-execution state, so that the statement can be reused.
+            SQLCancel(m_hStmt);
+            throw;
+        }
+    }
+    return result;
+}
+
+SQLRETURN SqlStatement::ExecutePrepared()
+{
+    auto const result = SQLExecute(m_hStmt);
+    return result == SQL_NEED_DATA ? PutDataAtExecution() : result;
+}
+
+void SqlStatement::PlanPostProcessOutputColumn(SqlOutputColumnFixup&& fixup)
+{
+    m_data->outputColumnFixups.emplace_back(std::move(fixup));
+}
+
+void SqlStatement::ForgetOutputColumnFixups(SQLUSMALLINT column) noexcept
 {
-    m_data->postProcessOutputColumnCallbacks.emplace_back(std::move(cb));
+    std::erase_if(m_data->outputColumnFixups, [column](auto const& fixup) { return fixup.column == column; });
 }
 
 SqlServerType SqlStatement::ServerType() const noexcept
@@ -55,12 +137,60 @@ SqlServerType SqlStatement::ServerType() const noexcept
     return m_connection->ServerType();
 }
 
+SqlColumnMetadata const* SqlStatement::DescribeColumn(SQLUSMALLINT column) const noexcept
+{
+    try
+    {
+        auto const columns = DescribeColumns();
+        return column >= 1 && column <= columns.size() ? &columns[column - 1] : nullptr;
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+std::span<SqlColumnMetadata const> SqlStatement::DescribeColumns() const
+{
+    if (m_data->columns)
+        return *m_data->columns;
+
+    auto columns = std::vector<SqlColumnMetadata>(NumColumnsAffected());
+    for (auto&& [index, metadata]: columns | std::views::enumerate)
+    {
+        auto const column = static_cast<SQLUSMALLINT>(index + 1);
+        auto name = std::array<SQLCHAR, 256> {};
+        SQLSMALLINT nameLength {};
+        SQLSMALLINT nullable {};
+        RequireSuccess(SQLDescribeColA(m_hStmt,
+                                       column,
+                                       name.data(),
+                                       static_cast<SQLSMALLINT>(name.size()),
+                                       &nameLength,
+                                       &metadata.sqlType,
+                                       &metadata.size,
+                                       &metadata.decimalDigits,
+                                       &nullable));
+        metadata.name.assign(reinterpret_cast<char const*>(name.data()),
+                             (std::min)(static_cast<std::size_t>(nameLength), name.size() - 1));
+        metadata.nullable = nullable != SQL_NO_NULLS;
+    }
+
+    return *(m_data->columns = std::move(columns));
+}
+
 SqlStatement::SqlStatement():
     m_data { new Data {
                  .ownedConnection = SqlConnection(),
                  .indicators = {},
                  .postExecuteCallbacks = {},
-                 .postProcessOutputColumnCallbacks = {},
+                 .outputColumnFixups = {},
+                 .blockIndicators = {},
+                 .blockRowCount = {},
+                 .blockRowStride = {},
+                 .rowsFetched = {},
+                 .columnBuffers = {},
+                 .columns = {},
              },
              [](Data* data) {
                  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
@@ -70,7 +200,7 @@ SqlStatement::SqlStatement():
     m_connection { &*m_data->ownedConnection }
 {
     if (m_connection->NativeHandle())
-        RequireSuccess(SQLAllocHandle(SQL_HANDLE_STMT, m_connection->NativeHandle(), &m_hStmt));
+        RequireSuccess(m_connection->StatementCache().AllocateHandle(m_connection->NativeHandle(), &m_hStmt));
 }
 
 SqlStatement::SqlStatement(SqlStatement&& other) noexcept:
@@ -112,7 +242,7 @@ SqlStatement::SqlStatement(SqlConnection& relatedConnection):
              } },
     m_connection { &relatedConnection }
 {
-    RequireSuccess(SQLAllocHandle(SQL_HANDLE_STMT, m_connection->NativeHandle(), &m_hStmt));
+    RequireSuccess(m_connection->StatementCache().AllocateHandle(m_connection->NativeHandle(), &m_hStmt));
 }
 
 SqlStatement::SqlStatement(std::nullopt_t /*nullopt*/):
@@ -123,8 +253,45 @@ SqlStatement::SqlStatement(std::nullopt_t /*nullopt*/):
 
 SqlStatement::~SqlStatement() noexcept
 {
-    SqlLogger::GetLogger().OnFetchEnd();
-    SQLFreeHandle(SQL_HANDLE_STMT, m_hStmt);
+    if (SqlLogger::IsEnabled(SqlLogger::Event::FETCH))
+        SqlLogger::GetLogger().OnFetchEnd();
+    ReleaseToStatementCache();
+    if (m_connection)
+        m_connection->StatementCache().FreeHandle(m_hStmt);
+    else
+        SQLFreeHandle(SQL_HANDLE_STMT, m_hStmt);
+}
+
+void SqlStatement::ReleaseToStatementCache() noexcept
+{
+    if (!m_connection || !m_connection->NativeHandle() || !m_hStmt || m_preparedQuery.empty())
+        return;
+
+    auto& cache = m_connection->StatementCache();
+    if (!cache.Enabled())
+        return;
+
+    // Reset the handle to a clean prepared state for its next user.
+    SQLFreeStmt(m_hStmt, SQL_CLOSE);
+    ResetBlockFetch();
+    SQLFreeStmt(m_hStmt, SQL_UNBIND);
+    m_data->outputColumnFixups.clear();
+    SQLFreeStmt(m_hStmt, SQL_RESET_PARAMS);
+    SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) 1, 0);
+    SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_OFFSET_PTR, nullptr, 0);
+
+    try
+    {
+        cache.Put(m_preparedQuery, { .handle = m_hStmt, .parameterCount = m_expectedParameterCount });
+    }
+    catch (std::bad_alloc const&)
+    {
+        // Running out of memory while caching must not terminate (e.g. in the destructor), so free the handle instead.
+        cache.FreeHandle(m_hStmt);
+    }
+
+    m_hStmt = SQL_NULL_HSTMT;
+    m_preparedQuery.clear();
 }
 
 SqlStatement SqlStatement::Prepare(std::string_view query) &&
@@ -136,12 +303,35 @@ SqlStatement SqlStatement::Prepare(std::string_view query) &&
 
 void SqlStatement::Prepare(std::string_view query) &
 {
-    SqlLogger::GetLogger().OnPrepare(query);
-
-    m_preparedQuery = std::string(query);
+    if (SqlLogger::IsEnabled(SqlLogger::Event::PREPARE))
+        SqlLogger::GetLogger().OnPrepare(query);
 
     m_data->postExecuteCallbacks.clear();
-    m_data->postProcessOutputColumnCallbacks.clear();
+    m_data->outputColumnFixups.clear();
+    m_data->columns.reset();
+
+    if (auto& cache = m_connection->StatementCache(); cache.Enabled())
+    {
+        // Hand the currently prepared handle back and try to reuse one already prepared for this query.
+        ReleaseToStatementCache();
+
+        if (auto const cached = cache.Take(query); cached.has_value())
+        {
+            // The current handle is still set if it was not prepared (e.g. fresh, or after ExecuteDirect()).
+            cache.FreeHandle(m_hStmt);
+            m_hStmt = cached->handle;
+            m_expectedParameterCount = cached->parameterCount;
+            m_preparedQuery = std::string(query);
+            m_data->indicators.resize(m_expectedParameterCount + 1);
+            return;
+        }
+
+        if (!m_hStmt)
+            RequireSuccess(cache.AllocateHandle(m_connection->NativeHandle(), &m_hStmt));
+    }
+
+    m_preparedQuery.clear();
+    ResetBlockFetch();
 
     // Unbinds the columns, if any
     RequireSuccess(SQLFreeStmt(m_hStmt, SQL_UNBIND));
@@ -150,6 +340,8 @@ void SqlStatement::Prepare(std::string_view query) &
     RequireSuccess(SQLPrepareA(m_hStmt, (SQLCHAR*) query.data(), (SQLINTEGER) query.size()));
     RequireSuccess(SQLNumParams(m_hStmt, &m_expectedParameterCount));
     m_data->indicators.resize(m_expectedParameterCount + 1);
+
+    m_preparedQuery = std::string(query);
 }
 
 void SqlStatement::ExecuteDirect(const std::string_view& query, std::source_location location)
@@ -158,14 +350,49 @@ void SqlStatement::ExecuteDirect(const std::string_view& query, std::source_loca
         return;
 
     m_preparedQuery.clear();
-    SqlLogger::GetLogger().OnExecuteDirect(query);
+    m_data->columns.reset();
+    if (SqlLogger::IsEnabled(SqlLogger::Event::EXECUTE))
+        SqlLogger::GetLogger().OnExecuteDirect(query);
 
     RequireSuccess(SQLExecDirectA(m_hStmt, (SQLCHAR*) query.data(), (SQLINTEGER) query.size()), location);
 }
 
+SqlTask<void> SqlStatement::ExecuteDirectAsync(SqlReactor& reactor, std::string query)
+{
+    if (query.empty())
+        co_return;
+
+    m_preparedQuery.clear();
+    m_data->columns.reset();
+    if (SqlLogger::IsEnabled(SqlLogger::Event::EXECUTE))
+        SqlLogger::GetLogger().OnExecuteDirect(query);
+
+    auto const asyncScope = AsyncExecutionScope { m_hStmt };
+    RequireSuccess(co_await reactor.Poll(
+        m_hStmt, [&] { return SQLExecDirectA(m_hStmt, (SQLCHAR*) query.data(), (SQLINTEGER) query.size()); }));
+}
+
+SqlTask<void> SqlStatement::ExecuteBoundAsync(SqlReactor& reactor)
+{
+    auto result = SQLRETURN {};
+    {
+        auto const asyncScope = AsyncExecutionScope { m_hStmt };
+        result = co_await reactor.Poll(m_hStmt, [this] { return SQLExecute(m_hStmt); });
+    }
+
+    if (result == SQL_NEED_DATA)
+        result = PutDataAtExecution();
+
+    if (result != SQL_NO_DATA && result != SQL_SUCCESS && result != SQL_SUCCESS_WITH_INFO)
+        throw SqlException(SqlErrorInfo::fromStatementHandle(m_hStmt), std::source_location::current());
+
+    ProcessPostExecuteCallbacks();
+}
+
 void SqlStatement::ExecuteWithVariants(std::vector<SqlVariant> const& args)
 {
-    SqlLogger::GetLogger().OnExecute(m_preparedQuery);
+    if (SqlLogger::IsEnabled(SqlLogger::Event::EXECUTE))
+        SqlLogger::GetLogger().OnExecute(m_preparedQuery);
 
     if (!(m_expectedParameterCount == (std::numeric_limits<decltype(m_expectedParameterCount)>::max)() && args.empty())
         && !(static_cast<size_t>(m_expectedParameterCount) == args.size()))
@@ -174,7 +401,7 @@ void SqlStatement::ExecuteWithVariants(std::vector<SqlVariant> const& args)
     for (auto const& [i, arg]: args | std::views::enumerate)
         SqlDataBinder<SqlVariant>::InputParameter(m_hStmt, static_cast<SQLUSMALLINT>(1 + i), arg, *this);
 
-    RequireSuccess(SQLExecute(m_hStmt));
+    RequireSuccess(ExecutePrepared());
     ProcessPostExecuteCallbacks();
 }
 
@@ -207,36 +434,206 @@ bool SqlStatement::FetchRow()
     if (result.has_value())
         return result.value();
 
-    SqlErrorInfo errorInfo = std::move(result.error());
-    if (errorInfo.sqlState == "07009")
-        throw std::invalid_argument(std::format("SQL error: {}", errorInfo));
-    else
-        throw SqlException(std::move(errorInfo));
+    ThrowFetchError(std::move(result.error()));
 }
 
 std::expected<bool, SqlErrorInfo> SqlStatement::TryFetchRow(std::source_location location) noexcept
 {
-    auto const sqlResult = SQLFetch(m_hStmt);
+    PrepareFetchRow();
+    return FinishFetchRow(SQLFetch(m_hStmt), location);
+}
+
+SqlTask<bool> SqlStatement::FetchRowAsync(SqlReactor& reactor)
+{
+    PrepareFetchRow();
+
+    auto sqlResult = SQLRETURN {};
+    {
+        auto const asyncScope = AsyncExecutionScope { m_hStmt };
+        sqlResult = co_await reactor.Poll(m_hStmt, [this] { return SQLFetch(m_hStmt); });
+    }
+
+    auto result = FinishFetchRow(sqlResult, std::source_location::current());
+    if (!result.has_value())
+        ThrowFetchError(std::move(result.error()));
+    co_return result.value();
+}
+
+void SqlStatement::PrepareFetchRow() noexcept
+{
+    // Switch back to single row fetching, in case FetchRows() has been used before on this cursor.
+    ResetBlockFetch();
+
+    // Restore the bound buffers, in case post-processing the previous row has changed them.
+    for (auto& fixup: m_data->outputColumnFixups | std::views::reverse)
+        if (fixup.prepareFetch)
+            fixup.prepareFetch(fixup);
+}
+
+std::expected<bool, SqlErrorInfo> SqlStatement::FinishFetchRow(SQLRETURN sqlResult,
+                                                               std::source_location location) noexcept
+{
     switch (sqlResult)
     {
         case SQL_NO_DATA:
             SQLCloseCursor(m_hStmt);
-            m_data->postProcessOutputColumnCallbacks.clear();
-            SqlLogger::GetLogger().OnFetchEnd();
+            if (SqlLogger::IsEnabled(SqlLogger::Event::FETCH))
+                SqlLogger::GetLogger().OnFetchEnd();
             return false;
         default:
             if (!SQL_SUCCEEDED(sqlResult))
                 return MakeUnexpected(LastError(), location);
 
             // post-process the output columns, if needed
-            for (auto const& postProcess: m_data->postProcessOutputColumnCallbacks)
-                postProcess();
-            m_data->postProcessOutputColumnCallbacks.clear();
-            SqlLogger::GetLogger().OnFetchRow();
+            for (auto& fixup: m_data->outputColumnFixups)
+                fixup.postProcess(fixup);
+            if (SqlLogger::IsEnabled(SqlLogger::Event::FETCH))
+                SqlLogger::GetLogger().OnFetchRow();
             return true;
     }
 }
 
+SQLLEN* SqlStatement::PrepareBlockFetch(std::size_t rowCount, std::size_t columnCount, std::size_t rowSize)
+{
+    // With row-wise binding, the driver advances the indicator pointers by the row size as well,
+    // so the indicators of all columns are interleaved within a buffer of the same stride as the rows.
+    m_data->blockRowStride = rowSize / sizeof(SQLLEN);
+    m_data->blockIndicators.resize(rowCount * (rowSize != 0 ? m_data->blockRowStride : columnCount));
+
+    // Columns bound for single row fetching would otherwise receive a whole block of rows.
+    m_data->outputColumnFixups.clear();
+    RequireSuccess(SQLFreeStmt(m_hStmt, SQL_UNBIND));
+    m_data->blockRowCount = rowCount;
+    m_data->rowsFetched = 0;
+
+    // clang-format off
+    // NOLINTBEGIN(performance-no-int-to-ptr)
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER) (rowSize != 0 ? rowSize : SQL_BIND_BY_COLUMN), 0));
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER) rowCount, 0));
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_ROWS_FETCHED_PTR, &m_data->rowsFetched, 0));
+    // NOLINTEND(performance-no-int-to-ptr)
+    // clang-format on
+
+    return m_data->blockIndicators.data();
+}
+
+std::size_t SqlStatement::FetchBlock()
+{
+    auto const sqlResult = SQLFetch(m_hStmt);
+    switch (sqlResult)
+    {
+        case SQL_NO_DATA:
+            ResetBlockFetch();
+            SQLCloseCursor(m_hStmt);
+            if (SqlLogger::IsEnabled(SqlLogger::Event::FETCH))
+                SqlLogger::GetLogger().OnFetchEnd();
+            return 0;
+        default:
+            if (!SQL_SUCCEEDED(sqlResult))
+            {
+                // Retrieve the error before resetting the statement attributes, which clears the diagnostics.
+                auto errorInfo = LastError();
+                ResetBlockFetch();
+                if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+                    SqlLogger::GetLogger().OnError(errorInfo);
+                throw SqlException(std::move(errorInfo));
+            }
+
+            if (SqlLogger::IsEnabled(SqlLogger::Event::FETCH))
+                for ([[maybe_unused]] auto const _: std::views::iota(SQLULEN { 0 }, m_data->rowsFetched))
+                    SqlLogger::GetLogger().OnFetchRow();
+
+            return static_cast<std::size_t>(m_data->rowsFetched);
+    }
+}
+
+void SqlStatement::ResetBlockFetch() noexcept
+{
+    if (m_data->blockRowCount == 0)
+        return;
+
+    m_data->blockRowCount = 0;
+    m_data->blockRowStride = 0;
+    m_data->outputColumnFixups.clear();
+    SQLFreeStmt(m_hStmt, SQL_UNBIND);
+    SQLSetStmtAttr(m_hStmt, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER) SQL_BIND_BY_COLUMN, 0);
+    SQLSetStmtAttr(m_hStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER) 1, 0);
+    SQLSetStmtAttr(m_hStmt, SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+}
+
+void SqlStatement::ResetBatchParameters() noexcept
+{
+    // Subsequent executions must neither see the array size nor the (by then dangling) bind offset of a batch.
+    SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) 1, 0);
+    SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_TYPE, (SQLPOINTER) SQL_PARAM_BIND_BY_COLUMN, 0);
+    SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_OFFSET_PTR, nullptr, 0);
+}
+
+std::optional<std::span<std::byte const>> SqlStatement::GetColumnIntoBuffer(SQLUSMALLINT column,
+                                                                            SQLSMALLINT cType,
+                                                                            std::size_t charSize)
+{
+    if (m_data->columnBuffers.size() <= column)
+        m_data->columnBuffers.resize(column + 1);
+
+    auto& buffer = m_data->columnBuffers[column];
+    if (buffer.empty())
+    {
+        // Columns of unlimited size (e.g. TEXT) report no or a huge size, and rather grow on demand.
+        constexpr auto MaxInitialCharCount = SQLULEN { 4096 };
+        auto const* metadata = DescribeColumn(column);
+        auto const columnSize = metadata ? metadata->size : SQLULEN { 0 };
+        buffer.resize((std::clamp(columnSize, SQLULEN { 1 }, MaxInitialCharCount) + 1) * charSize);
+    }
+
+    // The buffer always has room for the null terminator the driver appends.
+    auto length = std::size_t { 0 };
+    while (true)
+    {
+        SQLLEN indicator {};
+        auto const sqlResult =
+            SQLGetData(m_hStmt, column, cType, buffer.data() + length, (SQLLEN) (buffer.size() - length), &indicator);
+        if (sqlResult == SQL_NO_DATA)
+        {
+            // Only the continuation of a value read in pieces may end this way. Before any data has been read,
+            // it means that the value has been retrieved already, which would otherwise pass for an empty string.
+            if (length == 0)
+                throw std::invalid_argument(
+                    std::format("The value of column {} has already been retrieved for the current row", column));
+            break;
+        }
+        RequireSuccess(sqlResult);
+
+        if (indicator == SQL_NULL_DATA)
+            return std::nullopt;
+
+        auto const available = buffer.size() - length - charSize;
+        if (sqlResult == SQL_SUCCESS
+            || (indicator != SQL_NO_TOTAL && static_cast<std::size_t>(indicator) <= available))
+        {
+            length += static_cast<std::size_t>(indicator);
+            break;
+        }
+
+        // The value has been truncated, so keep what has been read so far, and grow the buffer for the rest.
+        length += available;
+        if (indicator == SQL_NO_TOTAL)
+            buffer.resize(buffer.size() * 2);
+        else
+            buffer.resize(length + (static_cast<std::size_t>(indicator) - available) + charSize);
+    }
+
+    return std::span<std::byte const> { buffer.data(), length };
+}
+
+bool SqlStatement::IsNullInFetchedRows(SQLUSMALLINT column, std::size_t row) const noexcept
+{
+    auto const index = m_data->blockRowStride != 0
+                           ? (row * m_data->blockRowStride) + static_cast<std::size_t>(column - 1)
+                           : (static_cast<std::size_t>(column - 1) * m_data->blockRowCount) + row;
+    return index < m_data->blockIndicators.size() && m_data->blockIndicators[index] == SQL_NULL_DATA;
+}
+
 void SqlStatement::RequireSuccess(SQLRETURN error, std::source_location sourceLocation) const
 {
     if (SQL_SUCCEEDED(error))
@@ -245,7 +642,8 @@ void SqlStatement::RequireSuccess(SQLRETURN error, std::source_location sourceLo
     auto errorInfo = LastError();
     if (errorInfo.sqlState == "07009")
     {
-        SqlLogger::GetLogger().OnError(errorInfo, sourceLocation);
+        if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+            SqlLogger::GetLogger().OnError(errorInfo, sourceLocation);
         throw std::invalid_argument(std::format("SQL error: {}", errorInfo));
     }
     else
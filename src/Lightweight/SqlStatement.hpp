@@ -8,16 +8,24 @@
 #endif
 
 #include "Api.hpp"
+#include "SqlAsync.hpp"
 #include "SqlConnection.hpp"
 #include "SqlDataBinder.hpp"
 #include "SqlQuery.hpp"
 #include "Utils.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <expected>
+#include <memory>
+#include <numeric>
 #include <optional>
 #include <ranges>
 #include <source_location>
+#include <span>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -34,6 +42,11 @@ concept SqlQueryObject = requires(QueryObject const& queryObject) {
 
 class SqlResultCursor;
 
+/// @brief Represents a string view type that can refer to a column value retrieved by SqlStatement::GetColumnView().
+template <typename StringView>
+concept SqlColumnStringView =
+    std::same_as<StringView, std::string_view> || std::same_as<StringView, std::u16string_view>;
+
 /// @brief High level API for (prepared) raw SQL statements
 ///
 /// SQL prepared statement lifecycle:
@@ -87,6 +100,9 @@ class SqlStatement final: public SqlDataBinderCallback
 
     /// Prepares the statement for execution.
     ///
+    /// If the connection's statement cache is enabled, an already prepared handle for the same query
+    /// is reused, and the previously prepared handle is handed back to the cache.
+    ///
     /// @note When preparing a new SQL statement the previously executed statement, yielding a result set,
     ///       must have been closed.
     LIGHTWEIGHT_API void Prepare(std::string_view query) &;
@@ -140,12 +156,24 @@ class SqlStatement final: public SqlDataBinderCallback
     /// Each parameter represents a column, to be bound as input parameter.
     /// The element types of each column container must be explicitly supported.
     ///
-    /// In order to support column value types, their underlying storage must be contiguous.
-    /// Also the input range itself must be contiguous.
-    /// If any of these conditions are not met, the function will not compile - use ExecuteBatch() instead.
-    template <SqlInputParameterBatchBinder FirstColumnBatch, std::ranges::contiguous_range... MoreColumnBatches>
+    /// Contiguous columns of fixed-size native values are bound in place.
+    /// Columns of variable-length strings (e.g. std::string, SqlText) and of std::optional values are packed
+    /// into contiguous buffers along with a length/indicator array first, such that all rows are still executed
+    /// with a single driver call. As string rows are padded to the longest string, rows whose padded strings
+    /// would exceed detail::MaxPackedStringBatchBytes per column are split across several driver calls.
+    /// If any column is not supported, the function will not compile - use ExecuteBatch() instead.
+    template <SqlInputParameterBatchBinder FirstColumnBatch, std::ranges::sized_range... MoreColumnBatches>
     void ExecuteBatchNative(FirstColumnBatch const& firstColumnBatch, MoreColumnBatches const&... moreColumnBatches);
 
+    /// Executes the prepared statement on a batch of data, like ExecuteBatchNative(),
+    /// binding each column batch to the input parameter at the corresponding (1-based) position.
+    ///
+    /// Column batches at position 0 are not bound, and may be of any size. This allows a fixed set of
+    /// column batches to serve statements that only use a subset of them, in any order.
+    template <std::ranges::sized_range... ColumnBatches>
+    void ExecuteBatchNativeMapped(std::span<SQLUSMALLINT const> parameterPositions,
+                                  ColumnBatches const&... columnBatches);
+
     /// Executes the prepared statement on a batch of data.
     ///
     /// Each parameter represents a column, to be bound as input parameter,
@@ -165,6 +193,51 @@ class SqlStatement final: public SqlDataBinderCallback
     template <SqlInputParameterBatchBinder FirstColumnBatch, std::ranges::range... MoreColumnBatches>
     void ExecuteBatch(FirstColumnBatch const& firstColumnBatch, MoreColumnBatches const&... moreColumnBatches);
 
+    /// Inserts a batch of data into the given table using multi-row INSERT INTO ... VALUES queries.
+    ///
+    /// Each column batch holds the values of the respective column in @p columnNames.
+    /// The rows are split into chunks, as large as the server's maximum number of input parameters per query
+    /// (and rows per VALUES list) permits, and each chunk is inserted by a single query with one parameter
+    /// per value. This is an alternative to ExecuteBatchNative() for drivers where parameter arrays are slow
+    /// or not supported.
+    ///
+    /// The statement is (re-)prepared by this call. The column batches must yield references to their elements,
+    /// as these are bound in place.
+    ///
+    /// @return The total number of rows inserted.
+    template <SqlInputParameterBatchBinder FirstColumnBatch, std::ranges::sized_range... MoreColumnBatches>
+    std::size_t ExecuteInsertRows(std::string_view tableName,
+                                  std::span<std::string_view const> columnNames,
+                                  FirstColumnBatch const& firstColumnBatch,
+                                  MoreColumnBatches const&... moreColumnBatches);
+
+    /// Inserts a batch of data like ExecuteInsertRows(), and retrieves the values generated by the server
+    /// for @p returningColumn (e.g. an auto-incremented primary key), in the order of the inserted rows.
+    ///
+    /// The values are returned by the INSERT queries themselves (RETURNING, or OUTPUT INSERTED), so they are
+    /// exactly the ones generated for these rows, regardless of concurrent inserts or triggers.
+    /// They are assumed to be generated in ascending order within each query, as identities and sequences are.
+    ///
+    /// @throws std::invalid_argument if the SQL dialect cannot return generated values from an INSERT.
+    template <typename Generated,
+              SqlInputParameterBatchBinder FirstColumnBatch,
+              std::ranges::sized_range... MoreColumnBatches>
+    std::vector<Generated> ExecuteInsertRowsReturning(std::string_view tableName,
+                                                      std::string_view returningColumn,
+                                                      std::span<std::string_view const> columnNames,
+                                                      FirstColumnBatch const& firstColumnBatch,
+                                                      MoreColumnBatches const&... moreColumnBatches);
+
+    /// Executes the prepared statement on a batch of row structures, bound row-wise as input parameter arrays.
+    ///
+    /// The @p bindParameters callable is invoked as `bindParameters(rows.front(), bindParameter)` and must call
+    /// `bindParameter(column, &rows.front().member)` for each parameter of the prepared statement,
+    /// where each member is of a fixed-size native value type (see SqlBlockFetchValue).
+    /// The driver then reads the parameters of all rows in one go, using the size of @p Row as the stride,
+    /// without copying the values into per-column arrays first.
+    template <typename Row, typename ParameterBinder>
+    void ExecuteBatchRowWise(std::span<Row const> rows, ParameterBinder const& bindParameters);
+
     /// Executes the given query directly.
     LIGHTWEIGHT_API void ExecuteDirect(std::string_view const& query,
                                        std::source_location location = std::source_location::current());
@@ -202,12 +275,34 @@ class SqlStatement final: public SqlDataBinderCallback
     [[nodiscard]] T ExecuteDirectScalar(SqlQueryObject auto const& query,
                                         std::source_location location = std::source_location::current());
 
+    /// Binds the given arguments to the prepared statement and executes it asynchronously on the given reactor.
+    ///
+    /// The arguments are taken by value and live in the returned task until it has completed,
+    /// as they are only bound once the task starts. Character arrays must therefore be passed
+    /// as (owning) strings, such as std::string.
+    ///
+    /// @see SqlReactor
+    template <SqlInputParameterBinder... Args>
+    [[nodiscard]] SqlTask<void> ExecuteAsync(SqlReactor& reactor, Args... args);
+
+    /// Executes the given query directly and asynchronously on the given reactor.
+    ///
+    /// @see SqlReactor
+    [[nodiscard]] LIGHTWEIGHT_API SqlTask<void> ExecuteDirectAsync(SqlReactor& reactor, std::string query);
+
     /// Retrieves the number of rows affected by the last query.
     [[nodiscard]] LIGHTWEIGHT_API size_t NumRowsAffected() const;
 
     /// Retrieves the number of columns affected by the last query.
     [[nodiscard]] LIGHTWEIGHT_API size_t NumColumnsAffected() const;
 
+    /// Retrieves the metadata of the result columns of the prepared or directly executed query.
+    ///
+    /// The columns are described via SQLDescribeCol() once, and cached until another query is prepared
+    /// or executed directly. The cache is also used to presize the buffers for retrieving string columns,
+    /// and to determine the type of SqlVariant columns.
+    [[nodiscard]] LIGHTWEIGHT_API std::span<SqlColumnMetadata const> DescribeColumns() const;
+
     /// Retrieves the last insert ID of the given table.
     [[nodiscard]] LIGHTWEIGHT_API size_t LastInsertId(std::string_view tableName);
 
@@ -222,6 +317,50 @@ class SqlStatement final: public SqlDataBinderCallback
     [[nodiscard]] LIGHTWEIGHT_API std::expected<bool, SqlErrorInfo> TryFetchRow(
         std::source_location location = std::source_location::current()) noexcept;
 
+    /// Fetches the next row of the result set asynchronously on the given reactor, like FetchRow().
+    ///
+    /// @see SqlReactor
+    [[nodiscard]] LIGHTWEIGHT_API SqlTask<bool> FetchRowAsync(SqlReactor& reactor);
+
+    /// Fetches the next block of rows of the result set into the given column arrays (block cursor).
+    ///
+    /// Each argument is a contiguous range of a fixed-size native value type (see SqlBlockFetchValue),
+    /// receiving the values of the respective result column, starting with the first column.
+    /// All ranges must have the same size, which determines the number of rows fetched per driver call.
+    ///
+    /// @note Automatically closes the cursor at the end of the result set.
+    ///
+    /// @return The number of rows fetched into the arrays, or 0 if the end of the result set was reached.
+    template <std::ranges::contiguous_range... ColumnBatches>
+    [[nodiscard]] std::size_t FetchRows(ColumnBatches&... columnBatches);
+
+    /// Fetches the next block of rows of the result set into the given array of row structures (row-wise block cursor).
+    ///
+    /// The @p bindColumns callable is invoked as `bindColumns(rows.front(), bindColumn)` and must call
+    /// `bindColumn(column, &rows.front().member)` for each of the @p columnCount result columns,
+    /// where each member is of a fixed-size native value type (see SqlBlockFetchValue).
+    /// The driver then fills all rows in one go, using the size of @p Row as the stride.
+    /// The size of @p rows determines the number of rows fetched per driver call.
+    ///
+    /// @note Automatically closes the cursor at the end of the result set.
+    ///
+    /// @return The number of rows fetched, or 0 if the end of the result set was reached.
+    ///
+    /// @see CanFetchRowsInto()
+    template <typename Row, typename ColumnBinder>
+    [[nodiscard]] std::size_t FetchRowsInto(std::span<Row> rows, std::size_t columnCount, ColumnBinder const& bindColumns);
+
+    /// Tests if rows of the given type can be fetched row-wise with the given number of columns via FetchRowsInto().
+    template <typename Row>
+    [[nodiscard]] static constexpr bool CanFetchRowsInto(std::size_t columnCount) noexcept
+    {
+        // The column indicators are interleaved with the same stride as the rows.
+        return columnCount > 0 && sizeof(Row) % sizeof(SQLLEN) == 0 && columnCount * sizeof(SQLLEN) <= sizeof(Row);
+    }
+
+    /// Tests if the value of the given column (starting at 1) and row of the last block fetch is NULL.
+    [[nodiscard]] LIGHTWEIGHT_API bool IsNullInFetchedRows(SQLUSMALLINT column, std::size_t row) const noexcept;
+
     /// Closes the result cursor on queries that yield a result set, e.g. SELECT statements.
     ///
     /// Call this function when done with fetching the results before the end of the result set is reached.
@@ -246,16 +385,67 @@ class SqlStatement final: public SqlDataBinderCallback
     template <SqlGetColumnNativeType T>
     [[nodiscard]] std::optional<T> GetNullableColumn(SQLUSMALLINT column) const;
 
+    /// Retrieves the string value of the column at the given index for the currently selected row,
+    /// without copying it into a newly allocated string.
+    ///
+    /// The value is read into a buffer owned by the statement, which is initially sized according to the
+    /// column's size (as described by the driver), and only grows when a value does not fit.
+    /// Reading string columns this way thus does not allocate memory per row.
+    ///
+    /// @note The returned view is only valid until the next row is fetched,
+    ///       or the same column is retrieved again.
+    ///
+    /// @throws std::invalid_argument if the driver has no data left for the column,
+    ///         as its value has already been retrieved for the current row.
+    template <SqlColumnStringView StringView>
+    [[nodiscard]] StringView GetColumnView(SQLUSMALLINT column);
+
+    /// Retrieves the string value of the column at the given index for the currently selected row,
+    /// like GetColumnView(), but returns std::nullopt if the value is NULL.
+    template <SqlColumnStringView StringView>
+    [[nodiscard]] std::optional<StringView> GetNullableColumnView(SQLUSMALLINT column);
+
   private:
     LIGHTWEIGHT_API void RequireSuccess(SQLRETURN error,
                                         std::source_location sourceLocation = std::source_location::current()) const;
     LIGHTWEIGHT_API void PlanPostExecuteCallback(std::function<void()>&& cb) override;
-    LIGHTWEIGHT_API void PlanPostProcessOutputColumn(std::function<void()>&& cb) override;
+    LIGHTWEIGHT_API void PlanPostProcessOutputColumn(SqlOutputColumnFixup&& fixup) override;
     [[nodiscard]] LIGHTWEIGHT_API SqlServerType ServerType() const noexcept override;
+    [[nodiscard]] LIGHTWEIGHT_API SqlColumnMetadata const* DescribeColumn(SQLUSMALLINT column) const noexcept override;
     LIGHTWEIGHT_API void ProcessPostExecuteCallbacks();
+    LIGHTWEIGHT_API SQLRETURN PutDataAtExecution();
+
+    // Executes the prepared statement, putting the data of its data-at-execution parameters (SqlInputStream),
+    // if any. All synchronous executions of prepared statements go through here.
+    LIGHTWEIGHT_API SQLRETURN ExecutePrepared();
+
+    template <SqlInputParameterBinder... Args>
+    void BindInputParameters(Args const&... args);
+    template <typename OnChunkExecuted, typename FirstColumnBatch, typename... MoreColumnBatches>
+    void ExecuteInsertRowChunks(std::string_view tableName,
+                                std::optional<std::string_view> returningColumn,
+                                std::span<std::string_view const> columnNames,
+                                OnChunkExecuted const& onChunkExecuted,
+                                FirstColumnBatch const& firstColumnBatch,
+                                MoreColumnBatches const&... moreColumnBatches);
+    [[nodiscard]] LIGHTWEIGHT_API SqlTask<void> ExecuteBoundAsync(SqlReactor& reactor);
+    void PrepareFetchRow() noexcept;
+    [[nodiscard]] std::expected<bool, SqlErrorInfo> FinishFetchRow(SQLRETURN sqlResult,
+                                                                   std::source_location location) noexcept;
+
+    void ReleaseToStatementCache() noexcept;
+    LIGHTWEIGHT_API SQLLEN* PrepareBlockFetch(std::size_t rowCount, std::size_t columnCount, std::size_t rowSize = 0);
+    LIGHTWEIGHT_API std::size_t FetchBlock();
+    void ResetBlockFetch() noexcept;
+    LIGHTWEIGHT_API void ResetBatchParameters() noexcept;
+
+    LIGHTWEIGHT_API std::optional<std::span<std::byte const>> GetColumnIntoBuffer(SQLUSMALLINT column,
+                                                                                  SQLSMALLINT cType,
+                                                                                  std::size_t charSize);
 
     LIGHTWEIGHT_API void RequireIndicators();
     LIGHTWEIGHT_API SQLLEN* GetIndicatorForColumn(SQLUSMALLINT column) noexcept;
+    LIGHTWEIGHT_API void ForgetOutputColumnFixups(SQLUSMALLINT column) noexcept;
 
     // private data members
     struct Data;
@@ -458,7 +648,10 @@ inline LIGHTWEIGHT_FORCE_INLINE void SqlStatement::BindOutputColumns(Args*... ar
     RequireIndicators();
 
     SQLUSMALLINT i = 0;
-    ((++i, RequireSuccess(SqlDataBinder<Args>::OutputColumn(m_hStmt, i, args, GetIndicatorForColumn(i), *this))), ...);
+    ((++i,
+      ForgetOutputColumnFixups(i),
+      RequireSuccess(SqlDataBinder<Args>::OutputColumn(m_hStmt, i, args, GetIndicatorForColumn(i), *this))),
+     ...);
 }
 
 template <typename... Records>
@@ -471,6 +664,7 @@ void SqlStatement::BindOutputColumnsToRecord(Records*... records)
     ((Reflection::EnumerateMembers(*records,
                                    [this, &i]<size_t I, typename FieldType>(FieldType& value) {
                                        ++i;
+                                       ForgetOutputColumnFixups(i);
                                        RequireSuccess(SqlDataBinder<FieldType>::OutputColumn(
                                            m_hStmt, i, &value, GetIndicatorForColumn(i), *this));
                                    })),
@@ -481,6 +675,7 @@ template <SqlOutputColumnBinder T>
 inline LIGHTWEIGHT_FORCE_INLINE void SqlStatement::BindOutputColumn(SQLUSMALLINT columnIndex, T* arg)
 {
     RequireIndicators();
+    ForgetOutputColumnFixups(columnIndex);
 
     RequireSuccess(
         SqlDataBinder<T>::OutputColumn(m_hStmt, columnIndex, arg, GetIndicatorForColumn(columnIndex), *this));
@@ -499,38 +694,58 @@ inline LIGHTWEIGHT_FORCE_INLINE void SqlStatement::BindInputParameter(SQLSMALLIN
                                                                       Arg const& arg,
                                                                       ColumnName&& columnNameHint)
 {
-    SqlLogger::GetLogger().OnBindInputParameter(std::forward<ColumnName>(columnNameHint), arg);
+    if (SqlLogger::IsEnabled(SqlLogger::Event::BIND))
+        SqlLogger::GetLogger().OnBindInputParameter(std::forward<ColumnName>(columnNameHint), arg);
     BindInputParameter(columnIndex, arg);
 }
 
 template <SqlInputParameterBinder... Args>
-void SqlStatement::Execute(Args const&... args)
+void SqlStatement::BindInputParameters(Args const&... args)
 {
     // Each input parameter must have an address,
     // such that we can call SQLBindParameter() without needing to copy it.
     // The memory region behind the input parameter must exist until the SQLExecute() call.
 
-    SqlLogger::GetLogger().OnExecute(m_preparedQuery);
-
     if (!(m_expectedParameterCount == (std::numeric_limits<decltype(m_expectedParameterCount)>::max)()
           && sizeof...(args) == 0)
         && !(m_expectedParameterCount == sizeof...(args)))
         throw std::invalid_argument { "Invalid argument count" };
 
     SQLUSMALLINT i = 0;
+    auto const logBinds = SqlLogger::IsEnabled(SqlLogger::Event::BIND);
     ((++i,
-      SqlLogger::GetLogger().OnBindInputParameter({}, args),
+      logBinds ? SqlLogger::GetLogger().OnBindInputParameter({}, args) : void(),
       RequireSuccess(SqlDataBinder<Args>::InputParameter(m_hStmt, i, args, *this))),
      ...);
+}
+
+template <SqlInputParameterBinder... Args>
+void SqlStatement::Execute(Args const&... args)
+{
+    if (SqlLogger::IsEnabled(SqlLogger::Event::EXECUTE))
+        SqlLogger::GetLogger().OnExecute(m_preparedQuery);
 
-    auto const result = SQLExecute(m_hStmt);
+    BindInputParameters(args...);
 
+    auto const result = ExecutePrepared();
     if (result != SQL_NO_DATA && result != SQL_SUCCESS && result != SQL_SUCCESS_WITH_INFO)
         throw SqlException(SqlErrorInfo::fromStatementHandle(m_hStmt), std::source_location::current());
 
     ProcessPostExecuteCallbacks();
 }
 
+template <SqlInputParameterBinder... Args>
+SqlTask<void> SqlStatement::ExecuteAsync(SqlReactor& reactor, Args... args)
+{
+    if (SqlLogger::IsEnabled(SqlLogger::Event::EXECUTE))
+        SqlLogger::GetLogger().OnExecute(m_preparedQuery);
+
+    // The arguments are bound by address, so they are bound only here, where they live in the coroutine frame.
+    BindInputParameters(args...);
+
+    co_await ExecuteBoundAsync(reactor);
+}
+
 // clang-format off
 template <typename T>
 concept SqlNativeContiguousValueConcept =
@@ -551,45 +766,286 @@ concept SqlNativeContiguousValueConcept =
     || std::same_as<T, SqlDateTime>
     || std::same_as<T, SqlFixedString<T::Capacity, typename T::value_type, T::PostRetrieveOperation>>;
 
+// ANSI string types of variable length, whose values can be packed into a contiguous buffer.
+template <typename T>
+concept SqlPackableStringValue = requires(T const& value) {
+    { SqlBasicStringOperations<T>::Data(&value) } -> std::same_as<char const*>;
+    { SqlBasicStringOperations<T>::Size(&value) } -> std::convertible_to<SQLULEN>;
+};
+
+// Column batches whose values can be bound in place as input parameter array.
+template <typename ColumnBatch>
+concept SqlNativeColumnBatch =
+       std::ranges::contiguous_range<ColumnBatch>
+    && SqlNativeContiguousValueConcept<std::ranges::range_value_t<ColumnBatch>>;
+
+// Column batches of (optional) strings, packed into a contiguous buffer along with a length/indicator array.
+template <typename ColumnBatch>
+concept SqlPackedStringColumnBatch =
+       std::ranges::sized_range<ColumnBatch>
+    && !SqlNativeColumnBatch<ColumnBatch>
+    && (SqlPackableStringValue<std::ranges::range_value_t<ColumnBatch>>
+        || (IsSpecializationOf<std::optional, std::ranges::range_value_t<ColumnBatch>>
+            && SqlPackableStringValue<typename std::ranges::range_value_t<ColumnBatch>::value_type>));
+
+// Column batches of optional fixed-size values, packed into a contiguous array along with a NULL indicator array.
+template <typename ColumnBatch>
+concept SqlPackedNullableColumnBatch =
+       std::ranges::sized_range<ColumnBatch>
+    && !SqlPackedStringColumnBatch<ColumnBatch>
+    && IsSpecializationOf<std::optional, std::ranges::range_value_t<ColumnBatch>>
+    && SqlInputParameterArrayBinder<typename std::ranges::range_value_t<ColumnBatch>::value_type>;
+
+template <typename ColumnBatch>
+concept SqlNativeBatchableColumn =
+       SqlNativeColumnBatch<ColumnBatch>
+    || SqlPackedStringColumnBatch<ColumnBatch>
+    || SqlPackedNullableColumnBatch<ColumnBatch>;
+
 template <typename FirstColumnBatch, typename... MoreColumnBatches>
 concept SqlNativeBatchable =
-        std::ranges::contiguous_range<FirstColumnBatch>
-    && (std::ranges::contiguous_range<MoreColumnBatches> && ...)
-    &&  SqlNativeContiguousValueConcept<std::ranges::range_value_t<FirstColumnBatch>>
-    && (SqlNativeContiguousValueConcept<std::ranges::range_value_t<MoreColumnBatches>> && ...);
+       SqlNativeBatchableColumn<FirstColumnBatch>
+    && (SqlNativeBatchableColumn<MoreColumnBatches> && ...);
+
+// Fixed-size native value types that can be fetched into arrays via FetchRows(),
+// as their values are laid out contiguously without any post-processing needed.
+template <typename T>
+concept SqlBlockFetchValue =
+       SqlNativeContiguousValueConcept<T>
+    && !requires { T::Capacity; };
 
 // clang-format on
 
-template <SqlInputParameterBatchBinder FirstColumnBatch, std::ranges::contiguous_range... MoreColumnBatches>
+namespace detail
+{
+
+// Input parameter array of a single column batch, as bound by SqlStatement::ExecuteBatchNative().
+template <typename ColumnBatch>
+class SqlBatchColumn;
+
+// Binds the values of the column batch in place.
+template <SqlNativeColumnBatch ColumnBatch>
+class SqlBatchColumn<ColumnBatch>
+{
+  public:
+    using ValueType = std::ranges::range_value_t<ColumnBatch>;
+
+    SqlBatchColumn(ColumnBatch const& batch, std::size_t offset, std::size_t /*count*/) noexcept:
+        m_values { std::ranges::data(batch) + (offset < std::ranges::size(batch) ? offset : 0) }
+    {
+    }
+
+    SQLRETURN Bind(SQLHSTMT stmt, SQLUSMALLINT column, SqlDataBinderCallback& cb) noexcept
+    {
+        return SqlDataBinder<ValueType>::InputParameter(stmt, column, *m_values, cb);
+    }
+
+  private:
+    ValueType const* m_values;
+};
+
+// Packs the (optional) strings of the column batch's rows [offset, offset + count) into one buffer,
+// each row padded to the longest string among them.
+template <SqlPackedStringColumnBatch ColumnBatch>
+class SqlBatchColumn<ColumnBatch>
+{
+  public:
+    using ValueType = std::ranges::range_value_t<ColumnBatch>;
+
+    SqlBatchColumn(ColumnBatch const& batch, std::size_t offset, std::size_t count)
+    {
+        auto const rows = batch | std::views::drop(offset) | std::views::take(count);
+
+        m_indicators.reserve(count);
+        for (auto const& value: rows)
+        {
+            auto const text = ViewOf(value);
+            m_indicators.push_back(text ? static_cast<SQLLEN>(text->size()) : SQL_NULL_DATA);
+            m_maxLength = (std::max)(m_maxLength, text ? text->size() : 0);
+        }
+
+        m_buffer.resize(m_indicators.size() * RowSize());
+        auto* row = m_buffer.data();
+        for (auto const& value: rows)
+        {
+            if (auto const text = ViewOf(value); text)
+                std::ranges::copy(*text, row);
+            row += RowSize();
+        }
+    }
+
+    // Retrieves the length each row of the given value is padded to, at least.
+    static std::size_t LengthOf(ValueType const& value) noexcept
+    {
+        auto const text = ViewOf(value);
+        return text ? text->size() : 0;
+    }
+
+    SQLRETURN Bind(SQLHSTMT stmt, SQLUSMALLINT column, SqlDataBinderCallback& /*cb*/) noexcept
+    {
+        return SQLBindParameter(stmt,
+                                column,
+                                SQL_PARAM_INPUT,
+                                SQL_C_CHAR,
+                                SQL_VARCHAR,
+                                RowSize(),
+                                0,
+                                (SQLPOINTER) m_buffer.data(),
+                                static_cast<SQLLEN>(RowSize()),
+                                m_indicators.data());
+    }
+
+  private:
+    template <typename T>
+    static std::optional<std::string_view> ViewOf(T const& value) noexcept
+    {
+        if constexpr (IsSpecializationOf<std::optional, T>)
+            return value ? ViewOf(*value) : std::nullopt;
+        else
+            return std::string_view { SqlBasicStringOperations<T>::Data(&value),
+                                      SqlBasicStringOperations<T>::Size(&value) };
+    }
+
+    // Rows are never empty, as drivers reject a zero buffer length.
+    [[nodiscard]] std::size_t RowSize() const noexcept
+    {
+        return (std::max)(m_maxLength, std::size_t { 1 });
+    }
+
+    std::size_t m_maxLength = 0;
+    std::vector<char> m_buffer;
+    std::vector<SQLLEN> m_indicators;
+};
+
+// Packs the optional fixed-size values of the column batch into one array, with NULL indicators for empty values.
+template <SqlPackedNullableColumnBatch ColumnBatch>
+class SqlBatchColumn<ColumnBatch>
+{
+  public:
+    using ValueType = typename std::ranges::range_value_t<ColumnBatch>::value_type;
+    using ElementType = typename SqlParameterArrayElement<ValueType>::type;
+
+    SqlBatchColumn(ColumnBatch const& batch, std::size_t offset, std::size_t count):
+        m_values { std::make_unique<ElementType[]>(count) }
+    {
+        m_indicators.reserve(count);
+        for (auto const& value: batch | std::views::drop(offset) | std::views::take(count))
+        {
+            if (value)
+                m_values[m_indicators.size()] = SqlParameterArrayElement<ValueType>::From(*value);
+            m_indicators.push_back(value ? static_cast<SQLLEN>(sizeof(ElementType)) : SQL_NULL_DATA);
+        }
+    }
+
+    SQLRETURN Bind(SQLHSTMT stmt, SQLUSMALLINT column, SqlDataBinderCallback& cb) noexcept
+    {
+        return SqlDataBinder<ValueType>::InputParameterArray(stmt, column, m_values.get(), m_indicators.data(), cb);
+    }
+
+  private:
+    std::unique_ptr<ElementType[]> m_values; // Not a std::vector, as std::vector<bool> is not contiguous.
+    std::vector<SQLLEN> m_indicators;
+};
+
+// Upper bound of the buffer a packed string column is bound with in one execution of ExecuteBatchNative().
+// As each row is padded to the longest string, a few long values would otherwise inflate all rows' buffers.
+constexpr std::size_t MaxPackedStringBatchBytes = 4 * 1024 * 1024;
+
+// Widens the given per-row lengths to the lengths of the column batch's strings, if it is packed.
+template <typename ColumnBatch>
+void WidenPackedRowLengths(ColumnBatch const& batch, std::vector<std::size_t>& rowLengths) noexcept
+{
+    if constexpr (SqlPackedStringColumnBatch<ColumnBatch>)
+        for (auto&& [length, value]: std::views::zip(rowLengths, batch))
+            length = (std::max)(length, SqlBatchColumn<ColumnBatch>::LengthOf(value));
+}
+
+} // namespace detail
+
+template <SqlInputParameterBatchBinder FirstColumnBatch, std::ranges::sized_range... MoreColumnBatches>
 void SqlStatement::ExecuteBatchNative(FirstColumnBatch const& firstColumnBatch,
                                       MoreColumnBatches const&... moreColumnBatches)
 {
-    static_assert(SqlNativeBatchable<FirstColumnBatch, MoreColumnBatches...>,
-                  "Must be a supported native contiguous element type.");
+    static constexpr auto ParameterPositions = [] {
+        auto positions = std::array<SQLUSMALLINT, 1 + sizeof...(MoreColumnBatches)> {};
+        std::iota(positions.begin(), positions.end(), SQLUSMALLINT { 1 });
+        return positions;
+    }();
 
-    if (m_expectedParameterCount != 1 + sizeof...(moreColumnBatches))
+    ExecuteBatchNativeMapped(ParameterPositions, firstColumnBatch, moreColumnBatches...);
+}
+
+template <std::ranges::sized_range... ColumnBatches>
+void SqlStatement::ExecuteBatchNativeMapped(std::span<SQLUSMALLINT const> parameterPositions,
+                                            ColumnBatches const&... columnBatches)
+{
+    static_assert(SqlNativeBatchable<ColumnBatches...>, "Must be a supported native contiguous element type.");
+    static_assert(!(std::same_as<std::ranges::range_value_t<ColumnBatches>, SqlInputStream> || ...),
+                  "Data-at-execution parameters (SqlInputStream) cannot be bound as parameter arrays.");
+
+    auto const boundColumnCount = std::ranges::count_if(parameterPositions, [](auto pos) { return pos != 0; });
+    if (parameterPositions.size() != sizeof...(ColumnBatches) || boundColumnCount != m_expectedParameterCount)
         throw std::invalid_argument { "Invalid number of columns" };
 
-    const auto rowCount = std::ranges::size(firstColumnBatch);
-    if (!((std::size(moreColumnBatches) == rowCount) && ...))
-        throw std::invalid_argument { "Uneven number of rows" };
+    auto const rowCounts = std::array { std::ranges::size(columnBatches)... };
+    auto rowCount = std::optional<std::size_t> {};
+    for (auto const [position, columnRowCount]: std::views::zip(parameterPositions, rowCounts))
+    {
+        if (position == 0)
+            continue;
+        if (rowCount && *rowCount != columnRowCount)
+            throw std::invalid_argument { "Uneven number of rows" };
+        rowCount = columnRowCount;
+    }
+
+    // Packed string columns pad each row to the longest string of the execution, so the rows are executed in
+    // chunks whose padded buffers stay within the byte budget (which a single long string may exceed on its own).
+    auto const totalRowCount = rowCount.value_or(0);
+    auto rowLengths = std::vector<std::size_t> {};
+    if constexpr ((detail::SqlPackedStringColumnBatch<ColumnBatches> || ...))
+    {
+        rowLengths.resize(totalRowCount);
+        (detail::WidenPackedRowLengths(columnBatches, rowLengths), ...);
+    }
 
     size_t rowStart = 0;
+    auto const _ = detail::Finally([this] { ResetBatchParameters(); });
 
-    // clang-format off
-    // NOLINTNEXTLINE(performance-no-int-to-ptr)
-    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) rowCount, 0));
-    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_OFFSET_PTR, &rowStart, 0));
-    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_TYPE, SQL_PARAM_BIND_BY_COLUMN, 0));
-    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_OPERATION_PTR, SQL_PARAM_PROCEED, 0));
-    RequireSuccess(SqlDataBinder<std::remove_cvref_t<decltype(*std::ranges::data(firstColumnBatch))>>::
-                                   InputParameter(m_hStmt, 1, *std::ranges::data(firstColumnBatch), *this));
-    SQLUSMALLINT column = 1;
-    (RequireSuccess(SqlDataBinder<std::remove_cvref_t<decltype(*std::ranges::data(moreColumnBatches))>>::
-                        InputParameter(m_hStmt, ++column, *std::ranges::data(moreColumnBatches), *this)), ...);
-    RequireSuccess(SQLExecute(m_hStmt));
-    ProcessPostExecuteCallbacks();
-    // clang-format on
+    for (std::size_t offset = 0; offset < totalRowCount;)
+    {
+        auto chunkRowCount = std::size_t { 0 };
+        auto chunkRowLength = std::size_t { 1 };
+        while (offset + chunkRowCount < totalRowCount)
+        {
+            auto const rowLength =
+                rowLengths.empty() ? chunkRowLength : (std::max)(chunkRowLength, rowLengths[offset + chunkRowCount]);
+            if (chunkRowCount > 0 && rowLength * (chunkRowCount + 1) > detail::MaxPackedStringBatchBytes)
+                break;
+            chunkRowLength = rowLength;
+            ++chunkRowCount;
+        }
+
+        // Packs the columns that cannot be bound in place, and keeps them alive until after the execution.
+        auto columns = std::tuple<detail::SqlBatchColumn<ColumnBatches>...> {
+            detail::SqlBatchColumn<ColumnBatches> { columnBatches, offset, chunkRowCount }...
+        };
+
+        // clang-format off
+        // NOLINTNEXTLINE(performance-no-int-to-ptr)
+        RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) chunkRowCount, 0));
+        RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_OFFSET_PTR, &rowStart, 0));
+        RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_TYPE, SQL_PARAM_BIND_BY_COLUMN, 0));
+        RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_OPERATION_PTR, SQL_PARAM_PROCEED, 0));
+        std::apply([&](auto&... column) {
+            auto position = parameterPositions.begin();
+            ((*position != 0 ? RequireSuccess(column.Bind(m_hStmt, *position, *this)) : void(), ++position), ...);
+        }, columns);
+        RequireSuccess(ExecutePrepared());
+        ProcessPostExecuteCallbacks();
+        // clang-format on
+
+        offset += chunkRowCount;
+    }
 }
 
 template <SqlInputParameterBatchBinder FirstColumnBatch, std::ranges::range... MoreColumnBatches>
@@ -621,7 +1077,7 @@ void SqlStatement::ExecuteBatchSoft(FirstColumnBatch const& firstColumnBatch,
             [&]<SqlInputParameterBinder... ColumnValues>(ColumnValues const&... columnsInRow) {
                 SQLUSMALLINT column = 0;
                 ((++column, SqlDataBinder<ColumnValues>::InputParameter(m_hStmt, column, columnsInRow, *this)), ...);
-                RequireSuccess(SQLExecute(m_hStmt));
+                RequireSuccess(ExecutePrepared());
                 ProcessPostExecuteCallbacks();
             },
             std::make_tuple(std::ref(*std::ranges::next(std::ranges::begin(firstColumnBatch), rowIndex)),
@@ -629,6 +1085,188 @@ void SqlStatement::ExecuteBatchSoft(FirstColumnBatch const& firstColumnBatch,
     }
 }
 
+template <SqlInputParameterBatchBinder FirstColumnBatch, std::ranges::sized_range... MoreColumnBatches>
+std::size_t SqlStatement::ExecuteInsertRows(std::string_view tableName,
+                                            std::span<std::string_view const> columnNames,
+                                            FirstColumnBatch const& firstColumnBatch,
+                                            MoreColumnBatches const&... moreColumnBatches)
+{
+    auto numRowsInserted = std::size_t { 0 };
+    ExecuteInsertRowChunks(
+        tableName,
+        std::nullopt,
+        columnNames,
+        [&](std::size_t /*chunkRowCount*/) { numRowsInserted += NumRowsAffected(); },
+        firstColumnBatch,
+        moreColumnBatches...);
+    return numRowsInserted;
+}
+
+template <typename Generated,
+          SqlInputParameterBatchBinder FirstColumnBatch,
+          std::ranges::sized_range... MoreColumnBatches>
+std::vector<Generated> SqlStatement::ExecuteInsertRowsReturning(std::string_view tableName,
+                                                                std::string_view returningColumn,
+                                                                std::span<std::string_view const> columnNames,
+                                                                FirstColumnBatch const& firstColumnBatch,
+                                                                MoreColumnBatches const&... moreColumnBatches)
+{
+    auto generated = std::vector<Generated> {};
+    generated.reserve(std::ranges::size(firstColumnBatch));
+    ExecuteInsertRowChunks(
+        tableName,
+        returningColumn,
+        columnNames,
+        [&](std::size_t chunkRowCount) {
+            auto const chunkBegin = generated.size();
+            while (FetchRow())
+                generated.emplace_back(GetColumn<Generated>(1));
+            if (generated.size() - chunkBegin != chunkRowCount)
+                throw std::runtime_error { "The number of generated values does not match the inserted rows" };
+            std::ranges::sort(generated.begin() + static_cast<std::ptrdiff_t>(chunkBegin), generated.end());
+        },
+        firstColumnBatch,
+        moreColumnBatches...);
+    return generated;
+}
+
+template <typename OnChunkExecuted, typename FirstColumnBatch, typename... MoreColumnBatches>
+void SqlStatement::ExecuteInsertRowChunks(std::string_view tableName,
+                                          std::optional<std::string_view> returningColumn,
+                                          std::span<std::string_view const> columnNames,
+                                          OnChunkExecuted const& onChunkExecuted,
+                                          FirstColumnBatch const& firstColumnBatch,
+                                          MoreColumnBatches const&... moreColumnBatches)
+{
+    static_assert((std::is_reference_v<std::ranges::range_reference_t<FirstColumnBatch const>>
+                   && ... && std::is_reference_v<std::ranges::range_reference_t<MoreColumnBatches const>>),
+                  "The column batches must yield references to their elements");
+
+    constexpr auto ColumnCount = 1 + sizeof...(MoreColumnBatches);
+    if (columnNames.size() != ColumnCount)
+        throw std::invalid_argument { "Invalid number of columns" };
+
+    auto const rowCount = std::ranges::size(firstColumnBatch);
+    if (!((std::ranges::size(moreColumnBatches) == rowCount) && ...))
+        throw std::invalid_argument { "Uneven number of rows" };
+
+    auto const& traits = m_connection->Traits();
+    auto const chunkSize = std::max<std::size_t>(
+        1, (std::min)(traits.MaxInputParameterCount / ColumnCount, traits.MaxInsertRowCount));
+
+    auto preparedChunkSize = std::size_t { 0 };
+    for (std::size_t offset = 0; offset < rowCount; offset += chunkSize)
+    {
+        auto const chunkRowCount = (std::min)(chunkSize, rowCount - offset);
+
+        // Only the last chunk may differ in size, so we prepare at most two different queries.
+        if (chunkRowCount != preparedChunkSize)
+        {
+            auto query = Query(tableName).Insert();
+            for (auto const row: std::views::iota(std::size_t { 0 }, chunkRowCount))
+            {
+                if (row > 0)
+                    query.NextRow();
+                for (auto const& columnName: columnNames)
+                    query.Set(columnName, SqlWildcard);
+            }
+            if (returningColumn)
+            {
+                auto const sql = query.ToSqlReturning(*returningColumn);
+                if (!sql)
+                    throw std::invalid_argument { "The SQL server cannot return generated values from an INSERT" };
+                Prepare(*sql);
+            }
+            else
+                Prepare(query);
+            preparedChunkSize = chunkRowCount;
+        }
+
+        SQLUSMALLINT parameter = 0;
+        auto const bindParameter = [&]<typename T>(T const& value) {
+            ++parameter;
+            if (SqlLogger::IsEnabled(SqlLogger::Event::BIND))
+                SqlLogger::GetLogger().OnBindInputParameter({}, value);
+            RequireSuccess(SqlDataBinder<T>::InputParameter(m_hStmt, parameter, value, *this));
+        };
+        for (auto const row: std::views::iota(offset, offset + chunkRowCount))
+        {
+            bindParameter(*std::ranges::next(std::ranges::begin(firstColumnBatch), row));
+            (bindParameter(*std::ranges::next(std::ranges::begin(moreColumnBatches), row)), ...);
+        }
+
+        if (SqlLogger::IsEnabled(SqlLogger::Event::EXECUTE))
+            SqlLogger::GetLogger().OnExecute(m_preparedQuery);
+        RequireSuccess(ExecutePrepared());
+        ProcessPostExecuteCallbacks();
+        onChunkExecuted(chunkRowCount);
+    }
+}
+
+template <typename Row, typename ParameterBinder>
+void SqlStatement::ExecuteBatchRowWise(std::span<Row const> rows, ParameterBinder const& bindParameters)
+{
+    if (rows.empty())
+        return;
+
+    auto const _ = detail::Finally([this] { ResetBatchParameters(); });
+
+    // NOLINTBEGIN(performance-no-int-to-ptr)
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) rows.size(), 0));
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_TYPE, (SQLPOINTER) sizeof(Row), 0));
+    // NOLINTEND(performance-no-int-to-ptr)
+
+    SQLSMALLINT parameterCount = 0;
+    bindParameters(rows.front(), [&]<SqlBlockFetchValue T>(SQLUSMALLINT column, T const* firstRowValue) {
+        RequireSuccess(SqlDataBinder<T>::InputParameter(m_hStmt, column, *firstRowValue, *this));
+        ++parameterCount;
+    });
+
+    if (parameterCount != m_expectedParameterCount)
+        throw std::invalid_argument { "Invalid number of columns" };
+
+    RequireSuccess(ExecutePrepared());
+    ProcessPostExecuteCallbacks();
+}
+
+template <std::ranges::contiguous_range... ColumnBatches>
+std::size_t SqlStatement::FetchRows(ColumnBatches&... columnBatches)
+{
+    static_assert(sizeof...(ColumnBatches) > 0, "At least one column must be fetched.");
+    static_assert((SqlBlockFetchValue<std::ranges::range_value_t<ColumnBatches>> && ...),
+                  "Must be a supported fixed-size native element type.");
+
+    auto const rowCounts = std::array { std::ranges::size(columnBatches)... };
+    auto const rowCount = rowCounts.front();
+    if (rowCount == 0 || !std::ranges::all_of(rowCounts, [rowCount](auto n) { return n == rowCount; }))
+        throw std::invalid_argument { "Uneven number of rows" };
+
+    SQLLEN* const indicators = PrepareBlockFetch(rowCount, sizeof...(ColumnBatches));
+
+    SQLUSMALLINT column = 0;
+    ((++column,
+      RequireSuccess(SqlDataBinder<std::ranges::range_value_t<ColumnBatches>>::OutputColumn(
+          m_hStmt, column, std::ranges::data(columnBatches), indicators + ((column - 1) * rowCount), *this))),
+     ...);
+
+    return FetchBlock();
+}
+
+template <typename Row, typename ColumnBinder>
+std::size_t SqlStatement::FetchRowsInto(std::span<Row> rows, std::size_t columnCount, ColumnBinder const& bindColumns)
+{
+    if (rows.empty() || !CanFetchRowsInto<Row>(columnCount))
+        throw std::invalid_argument { "Rows cannot be fetched row-wise" };
+
+    SQLLEN* const indicators = PrepareBlockFetch(rows.size(), columnCount, sizeof(Row));
+
+    bindColumns(rows.front(), [&]<SqlBlockFetchValue T>(SQLUSMALLINT column, T* firstRowValue) {
+        RequireSuccess(SqlDataBinder<T>::OutputColumn(m_hStmt, column, firstRowValue, indicators + (column - 1), *this));
+    });
+
+    return FetchBlock();
+}
+
 template <SqlGetColumnNativeType T>
 inline bool SqlStatement::GetColumn(SQLUSMALLINT column, T* result) const
 {
@@ -671,6 +1309,28 @@ inline std::optional<T> SqlStatement::GetNullableColumn(SQLUSMALLINT column) con
     return { std::move(result) };
 }
 
+template <SqlColumnStringView StringView>
+inline std::optional<StringView> SqlStatement::GetNullableColumnView(SQLUSMALLINT column)
+{
+    using CharType = typename StringView::value_type;
+    constexpr auto CType = std::same_as<CharType, char> ? SQL_C_CHAR : SQL_C_WCHAR;
+
+    auto const bytes = GetColumnIntoBuffer(column, CType, sizeof(CharType));
+    if (!bytes)
+        return std::nullopt;
+
+    return StringView { reinterpret_cast<CharType const*>(bytes->data()), bytes->size() / sizeof(CharType) };
+}
+
+template <SqlColumnStringView StringView>
+inline StringView SqlStatement::GetColumnView(SQLUSMALLINT column)
+{
+    auto const result = GetNullableColumnView<StringView>(column);
+    if (!result)
+        throw std::runtime_error { "Column value is NULL" };
+    return *result;
+}
+
 inline LIGHTWEIGHT_FORCE_INLINE void SqlStatement::ExecuteDirect(SqlQueryObject auto const& query,
                                                                  std::source_location location)
 {
@@ -729,7 +1389,8 @@ inline LIGHTWEIGHT_FORCE_INLINE void SqlStatement::CloseCursor() noexcept
 {
     // SQLCloseCursor(m_hStmt);
     SQLFreeStmt(m_hStmt, SQL_CLOSE);
-    SqlLogger::GetLogger().OnFetchEnd();
+    if (SqlLogger::IsEnabled(SqlLogger::Event::FETCH))
+        SqlLogger::GetLogger().OnFetchEnd();
 }
 
 inline LIGHTWEIGHT_FORCE_INLINE SqlResultCursor SqlStatement::GetResultCursor() noexcept
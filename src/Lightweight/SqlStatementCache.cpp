@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SqlStatementCache.hpp"
+
+SqlStatementCache::~SqlStatementCache()
+{
+    Clear();
+}
+
+void SqlStatementCache::SetCapacity(std::size_t capacity) noexcept
+{
+    m_capacity = capacity;
+    EvictToCapacity();
+}
+
+SQLRETURN SqlStatementCache::AllocateHandle(SQLHDBC hDbc, SQLHSTMT* hStmt) noexcept
+{
+    auto const sqlReturn = SQLAllocHandle(SQL_HANDLE_STMT, hDbc, hStmt);
+    if (SQL_SUCCEEDED(sqlReturn))
+        ++m_allocatedHandles;
+    return sqlReturn;
+}
+
+void SqlStatementCache::FreeHandle(SQLHSTMT hStmt) noexcept
+{
+    if (!hStmt)
+        return;
+
+    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    --m_allocatedHandles;
+}
+
+std::optional<SqlStatementCache::Entry> SqlStatementCache::Take(std::string_view query)
+{
+    if (!Enabled())
+        return std::nullopt;
+
+    auto const it = m_entries.find(query);
+    if (it == m_entries.end())
+    {
+        ++m_misses;
+        return std::nullopt;
+    }
+
+    ++m_hits;
+    auto const entry = it->second->entry;
+    auto const item = it->second;
+    m_entries.erase(it);
+    m_items.erase(item);
+    return entry;
+}
+
+void SqlStatementCache::Put(std::string_view query, Entry entry)
+{
+    if (!Enabled() || m_entries.contains(query))
+    {
+        FreeHandle(entry.handle);
+        return;
+    }
+
+    m_items.emplace_front(Item { .query = std::string(query), .entry = entry });
+    try
+    {
+        m_entries.emplace(m_items.front().query, m_items.begin());
+    }
+    catch (...)
+    {
+        // Leave the handle to the caller, as documented.
+        m_items.pop_front();
+        throw;
+    }
+    EvictToCapacity();
+}
+
+void SqlStatementCache::Clear() noexcept
+{
+    for (auto const& item: m_items)
+        FreeHandle(item.entry.handle);
+
+    m_entries.clear();
+    m_items.clear();
+}
+
+void SqlStatementCache::EvictToCapacity() noexcept
+{
+    while (m_items.size() > m_capacity)
+    {
+        auto const& item = m_items.back();
+        FreeHandle(item.entry.handle);
+        m_entries.erase(item.query);
+        m_items.pop_back();
+    }
+}
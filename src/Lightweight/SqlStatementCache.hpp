@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <Windows.h>
+#endif
+
+#include "Api.hpp"
+
+#include <cstddef>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <sql.h>
+#include <sqlext.h>
+#include <sqlspi.h>
+#include <sqltypes.h>
+
+/// @brief LRU cache of prepared statement handles, keyed by their SQL query text.
+///
+/// Each SqlConnection owns one such cache. SqlStatement::Prepare() takes already prepared handles from it,
+/// and hands its handle back when preparing another query or when being destroyed,
+/// saving the (potentially server round trip) cost of re-preparing the same query over and over again.
+///
+/// The cache is disabled (capacity of zero) by default.
+class LIGHTWEIGHT_API SqlStatementCache final
+{
+  public:
+    /// A prepared statement handle along with the number of parameters it expects.
+    struct Entry
+    {
+        SQLHSTMT handle {};
+        SQLSMALLINT parameterCount {};
+    };
+
+    explicit SqlStatementCache(std::size_t capacity = 0) noexcept:
+        m_capacity { capacity }
+    {
+    }
+
+    SqlStatementCache(SqlStatementCache&&) = delete;
+    SqlStatementCache(SqlStatementCache const&) = delete;
+    SqlStatementCache& operator=(SqlStatementCache&&) = delete;
+    SqlStatementCache& operator=(SqlStatementCache const&) = delete;
+
+    /// Frees all cached statement handles.
+    ~SqlStatementCache();
+
+    /// Tests if the cache is enabled, i.e. its capacity is non-zero.
+    [[nodiscard]] bool Enabled() const noexcept
+    {
+        return m_capacity > 0;
+    }
+
+    /// Retrieves the maximum number of cached statement handles.
+    [[nodiscard]] std::size_t Capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /// Sets the maximum number of cached statement handles, evicting the least recently used ones if needed.
+    void SetCapacity(std::size_t capacity) noexcept;
+
+    /// Retrieves the number of currently cached statement handles.
+    [[nodiscard]] std::size_t Size() const noexcept
+    {
+        return m_entries.size();
+    }
+
+    /// Retrieves the number of successful lookups.
+    [[nodiscard]] std::size_t Hits() const noexcept
+    {
+        return m_hits;
+    }
+
+    /// Retrieves the number of failed lookups.
+    [[nodiscard]] std::size_t Misses() const noexcept
+    {
+        return m_misses;
+    }
+
+    /// Retrieves the number of statement handles allocated on the connection and not yet freed, cached or not.
+    ///
+    /// This is meant for diagnosing handle leaks: once all statements of the connection are destroyed,
+    /// it must equal Size(), as only the cached handles are left then.
+    [[nodiscard]] std::size_t AllocatedHandles() const noexcept
+    {
+        return m_allocatedHandles;
+    }
+
+    /// Allocates a new statement handle on the given connection handle, accounted for in AllocatedHandles().
+    [[nodiscard]] SQLRETURN AllocateHandle(SQLHDBC hDbc, SQLHSTMT* hStmt) noexcept;
+
+    /// Frees a statement handle allocated via AllocateHandle().
+    void FreeHandle(SQLHSTMT hStmt) noexcept;
+
+    /// Removes the prepared statement handle for the given query from the cache, if present.
+    ///
+    /// The caller takes ownership of the returned handle.
+    [[nodiscard]] std::optional<Entry> Take(std::string_view query);
+
+    /// Puts the given prepared statement handle into the cache, taking ownership of it.
+    ///
+    /// The handle is freed immediately if the cache is disabled or the query is already cached.
+    ///
+    /// @throws std::bad_alloc if the entry cannot be allocated, in which case the caller keeps ownership of the handle.
+    void Put(std::string_view query, Entry entry);
+
+    /// Frees all cached statement handles.
+    void Clear() noexcept;
+
+  private:
+    struct Item
+    {
+        std::string query;
+        Entry entry;
+    };
+
+    using ItemList = std::list<Item>; // Most recently used items are at the front.
+
+    void EvictToCapacity() noexcept;
+
+    std::size_t m_capacity;
+    std::size_t m_hits = 0;
+    std::size_t m_misses = 0;
+    std::size_t m_allocatedHandles = 0;
+    ItemList m_items;
+    std::unordered_map<std::string_view, ItemList::iterator> m_entries; // Keys refer to the queries in m_items.
+};
@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <format>
 #include <functional>
+#include <limits>
 #include <string_view>
 
 // Represents the type of SQL server, used to determine the correct SQL syntax, if needed.
@@ -90,6 +91,8 @@ struct SqlTraits
     std::string_view PrimaryKeyAutoIncrement; // Maybe rename this to `PrimaryKeyIdentityColumnType`?
     std::string_view CurrentTimestampExpr;
     size_t MaxStatementLength {};
+    size_t MaxInputParameterCount = 999; // Maximum number of input parameters in a single statement.
+    size_t MaxInsertRowCount = (std::numeric_limits<size_t>::max)(); // Maximum number of rows in a VALUES list.
     std::function<std::string_view(SqlColumnType)> ColumnTypeName;
 };
 
@@ -99,6 +102,8 @@ namespace detail
 inline SqlTraits const MicrosoftSqlTraits {
     .PrimaryKeyAutoIncrement = "INT IDENTITY(1,1) PRIMARY KEY",
     .CurrentTimestampExpr = "GETDATE()",
+    .MaxInputParameterCount = 2098, // 2100, minus the parameters sp_executesql/sp_prepexec takes on its own
+    .MaxInsertRowCount = 1000,
     .ColumnTypeName = [](SqlColumnType value) -> std::string_view {
         switch (value)
         {
@@ -117,6 +122,7 @@ inline SqlTraits const MicrosoftSqlTraits {
 inline SqlTraits const PostgresSqlTraits {
     .PrimaryKeyAutoIncrement = "SERIAL PRIMARY KEY",
     .CurrentTimestampExpr = "CURRENT_TIMESTAMP",
+    .MaxInputParameterCount = 65535,
     .ColumnTypeName = [](SqlColumnType value) -> std::string_view {
         switch (value)
         {
@@ -133,6 +139,7 @@ inline SqlTraits const PostgresSqlTraits {
 inline SqlTraits const OracleSqlTraits {
     .PrimaryKeyAutoIncrement = "NUMBER GENERATED BY DEFAULT ON NULL AS IDENTITY PRIMARY KEY",
     .CurrentTimestampExpr = "SYSTIMESTAMP",
+    .MaxInputParameterCount = 65535,
     .ColumnTypeName = [](SqlColumnType value) -> std::string_view {
         switch (value)
         {
@@ -169,6 +176,7 @@ inline SqlTraits const SQLiteTraits {
 inline SqlTraits const MySQLTraits {
     .PrimaryKeyAutoIncrement = "INT AUTO_INCREMENT PRIMARY KEY",
     .CurrentTimestampExpr = "NOW()",
+    .MaxInputParameterCount = 65535,
     .ColumnTypeName = detail::DefaultColumnTypeName,
 };
 
@@ -184,7 +192,7 @@ inline SqlTraits const& GetSqlTraits(SqlServerType serverType) noexcept
 {
     auto static const sqlTraits = std::array {
         &detail::UnknownSqlTraits, &detail::MicrosoftSqlTraits, &detail::PostgresSqlTraits,
-        &detail::OracleSqlTraits,  &detail::SQLiteTraits,
+        &detail::OracleSqlTraits,  &detail::SQLiteTraits,       &detail::MySQLTraits,
     };
 
     return *sqlTraits[static_cast<size_t>(serverType)];
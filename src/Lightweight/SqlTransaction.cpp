@@ -34,14 +34,16 @@ bool SqlTransaction::TryRollback() noexcept
     SQLRETURN sqlReturn = SQLEndTran(SQL_HANDLE_DBC, m_hDbc, SQL_ROLLBACK);
     if (sqlReturn != SQL_SUCCESS && sqlReturn != SQL_SUCCESS_WITH_INFO)
     {
-        SqlLogger::GetLogger().OnError(SqlErrorInfo::fromConnectionHandle(m_hDbc), m_location);
+        if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+            SqlLogger::GetLogger().OnError(SqlErrorInfo::fromConnectionHandle(m_hDbc), m_location);
         return false;
     }
 
     sqlReturn = SQLSetConnectAttr(m_hDbc, SQL_ATTR_AUTOCOMMIT, (SQLPOINTER) SQL_AUTOCOMMIT_ON, SQL_IS_UINTEGER);
     if (sqlReturn != SQL_SUCCESS && sqlReturn != SQL_SUCCESS_WITH_INFO)
     {
-        SqlLogger::GetLogger().OnError(SqlErrorInfo::fromConnectionHandle(m_hDbc), m_location);
+        if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+            SqlLogger::GetLogger().OnError(SqlErrorInfo::fromConnectionHandle(m_hDbc), m_location);
         return false;
     }
 
@@ -55,14 +57,16 @@ bool SqlTransaction::TryCommit() noexcept
     SQLRETURN sqlReturn = SQLEndTran(SQL_HANDLE_DBC, m_hDbc, SQL_COMMIT);
     if (sqlReturn != SQL_SUCCESS && sqlReturn != SQL_SUCCESS_WITH_INFO)
     {
-        SqlLogger::GetLogger().OnError(SqlErrorInfo::fromConnectionHandle(m_hDbc), m_location);
+        if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+            SqlLogger::GetLogger().OnError(SqlErrorInfo::fromConnectionHandle(m_hDbc), m_location);
         return false;
     }
 
     sqlReturn = SQLSetConnectAttr(m_hDbc, SQL_ATTR_AUTOCOMMIT, (SQLPOINTER) SQL_AUTOCOMMIT_ON, SQL_IS_UINTEGER);
     if (sqlReturn != SQL_SUCCESS && sqlReturn != SQL_SUCCESS_WITH_INFO)
     {
-        SqlLogger::GetLogger().OnError(SqlErrorInfo::fromConnectionHandle(m_hDbc), m_location);
+        if (SqlLogger::IsEnabled(SqlLogger::Event::ERRORS))
+            SqlLogger::GetLogger().OnError(SqlErrorInfo::fromConnectionHandle(m_hDbc), m_location);
         return false;
     }
 
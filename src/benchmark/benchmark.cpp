@@ -189,10 +189,11 @@ void count()
 
     auto count_and_compare = [&](std::string_view table, [[maybe_unused]] size_t expected_count) {
         stmt.ExecuteDirect(std::format("SELECT * FROM \"{}\"", table));
-        [[maybe_unused]] auto count = 0;
-        while (stmt.FetchRow())
+        [[maybe_unused]] size_t count = 0;
+        auto firstColumn = std::vector<int>(1000);
+        while (auto const rowCount = stmt.FetchRows(firstColumn))
         {
-            ++count;
+            count += rowCount;
         }
 #if 0
         if(count != expected_count)
@@ -204,7 +205,7 @@ void count()
 
     count_and_compare("lists", 80311);
     count_and_compare("movies", 226575);
-    // count_and_compare("ratings", 15520005); // TODO fix this
+    count_and_compare("ratings", 15520005);
 }
 
 void iterate()
@@ -218,6 +219,35 @@ void iterate()
     }
 }
 
+// Inserts the same rows with parameter arrays and with multi-row VALUES queries, for comparison.
+void insert()
+{
+    constexpr auto RowCount = 100'000;
+    auto const first = std::views::iota(0, RowCount) | std::ranges::to<std::vector>();
+    auto const second = first | std::views::transform([](int i) { return i * 0.5; }) | std::ranges::to<std::vector>();
+    auto const columnNames = std::array<std::string_view, 2> { "a", "b" };
+
+    auto stmt = SqlStatement {};
+    auto const measureInsert = [&](std::string_view name, auto&& insertRows) {
+        stmt.ExecuteDirect(R"(CREATE TABLE "insert_benchmark" ("a" INTEGER, "b" REAL))");
+        auto const start = std::chrono::high_resolution_clock::now();
+        insertRows();
+        auto const end = std::chrono::high_resolution_clock::now();
+        stmt.ExecuteDirect(R"(DROP TABLE "insert_benchmark")");
+        std::println("{:24} took {:5} ms for {} rows",
+                     name,
+                     std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count(),
+                     RowCount);
+    };
+
+    measureInsert("ExecuteBatchNative", [&] {
+        stmt.Prepare(R"(INSERT INTO "insert_benchmark" ("a", "b") VALUES (?, ?))");
+        stmt.ExecuteBatchNative(first, second);
+    });
+    measureInsert("ExecuteInsertRows",
+                  [&] { stmt.ExecuteInsertRows("insert_benchmark", columnNames, first, second); });
+}
+
 void run()
 {
     auto measureTime = [](auto&& f, std::string_view name, size_t measured) {
@@ -232,6 +262,7 @@ void run()
     measureTime(count, "count", 15);
     measureTime(longQuery, "longQuery", 4018);
     measureTime(iterate, "iterate", 0);
+    insert();
 }
 
 int main(int argc, char** argv)
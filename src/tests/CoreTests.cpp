@@ -4,8 +4,10 @@
 
 #include <Lightweight/DataBinder/UnicodeConverter.hpp>
 #include <Lightweight/SqlConnection.hpp>
+#include <Lightweight/SqlConnectionPool.hpp>
 #include <Lightweight/SqlDataBinder.hpp>
 #include <Lightweight/SqlQuery.hpp>
+#include <Lightweight/SqlQueryExecutor.hpp>
 #include <Lightweight/SqlQueryFormatter.hpp>
 #include <Lightweight/SqlScopedTraceLogger.hpp>
 #include <Lightweight/SqlStatement.hpp>
@@ -16,8 +18,24 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <array>
+#include <cstdio>
 #include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <future>
 #include <list>
+#include <optional>
+#include <ranges>
+#include <set>
+#include <thread>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <io.h>
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
 
 // NOLINTBEGIN(readability-container-size-empty)
 
@@ -220,6 +238,40 @@ TEST_CASE_METHOD(SqlTestFixture, "execute binding output parameters (direct)")
     REQUIRE(!stmt.FetchRow());
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "execute binding output parameters (multiple rows)")
+{
+    auto stmt = SqlStatement {};
+    CreateEmployeesTable(stmt);
+    FillEmployeesTable(stmt);
+
+    std::string firstName(20, '\0');
+    std::optional<std::string> lastName;
+    unsigned int salary {};
+
+    stmt.Prepare(R"(SELECT "FirstName", CASE WHEN "Salary" = 60000 THEN NULL ELSE "LastName" END, "Salary")"
+                 R"( FROM "Employees" ORDER BY "Salary")");
+    stmt.BindOutputColumns(&firstName, &lastName, &salary);
+    stmt.Execute();
+
+    // The bound columns are post-processed for every row, without the need to rebind them.
+    REQUIRE(stmt.FetchRow());
+    CHECK(firstName == "Alice");
+    CHECK(lastName == "Smith");
+    CHECK(salary == 50'000);
+
+    REQUIRE(stmt.FetchRow());
+    CHECK(firstName == "Bob");
+    CHECK(!lastName.has_value());
+    CHECK(salary == 60'000);
+
+    REQUIRE(stmt.FetchRow());
+    CHECK(firstName == "Charlie");
+    CHECK(lastName == "Brown");
+    CHECK(salary == 70'000);
+
+    REQUIRE(!stmt.FetchRow());
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatch", "[SqlStatement]")
 {
     auto stmt = SqlStatement {};
@@ -298,6 +350,574 @@ TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatchNative", "[SqlStateme
     REQUIRE(!stmt.FetchRow());
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatchNative with strings and optionals", "[SqlStatement]")
+{
+    auto stmt = SqlStatement {};
+    UNSUPPORTED_DATABASE(stmt, SqlServerType::ORACLE);
+
+    stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.CreateTable("Test")
+            .Column("A", SqlColumnTypeDefinitions::Varchar { 16 })
+            .Column("B", SqlColumnTypeDefinitions::Integer {})
+            .Column("C", SqlColumnTypeDefinitions::Varchar { 16 })
+            .Column("D", SqlColumnTypeDefinitions::Text {})
+            .Column("E", SqlColumnTypeDefinitions::Time {})
+            .Column("F", SqlColumnTypeDefinitions::Date {});
+    });
+
+    stmt.Prepare(R"(INSERT INTO "Test" ("A", "B", "C", "D", "E", "F") VALUES (?, ?, ?, ?, ?, ?))");
+
+    // None of these columns can be bound in place, so they are packed before executing all rows at once.
+    auto const first = std::vector<std::string> { "Hello", "", "World!" };
+    auto const second = std::vector<std::optional<int>> { 1, std::nullopt, 3 };
+    auto const third = std::vector<std::optional<std::string>> { std::nullopt, "Lorem ipsum", "x" };
+    auto const fourth = std::vector<SqlText> { { "a" }, { "bb" }, { "ccc" } };
+
+    // SqlTime is larger than the SQL_TIME_STRUCT its arrays are bound as, so all rows after the first
+    // would be misread if they were bound in place.
+    using namespace std::chrono;
+    auto const fifth = std::vector<std::optional<SqlTime>> {
+        SqlTime { 1h, 2min, 3s },
+        std::nullopt,
+        SqlTime { 23h, 59min, 58s },
+    };
+    auto const sixth = std::vector<std::optional<SqlDate>> {
+        std::nullopt,
+        SqlDate { year { 2024 }, March, day { 1 } },
+        SqlDate { year { 1999 }, December, day { 31 } },
+    };
+
+    static_assert(SqlNativeBatchable<decltype(first),
+                                     decltype(second),
+                                     decltype(third),
+                                     decltype(fourth),
+                                     decltype(fifth),
+                                     decltype(sixth)>);
+    stmt.ExecuteBatchNative(first, second, third, fourth, fifth, sixth);
+
+    stmt.ExecuteDirect(R"(SELECT "A", "B", "C", "D", "E", "F" FROM "Test" ORDER BY "A")");
+
+    REQUIRE(stmt.FetchRow());
+    CHECK(stmt.GetNullableColumn<std::string>(1).value_or("") == "");
+    CHECK(!stmt.GetNullableColumn<int>(2).has_value());
+    CHECK(stmt.GetNullableColumn<std::string>(3) == "Lorem ipsum");
+    CHECK(stmt.GetColumn<std::string>(4) == "bb");
+    CHECK(!stmt.GetNullableColumn<SqlTime>(5).has_value());
+    CHECK(stmt.GetNullableColumn<SqlDate>(6) == sixth[1]);
+
+    REQUIRE(stmt.FetchRow());
+    CHECK(stmt.GetColumn<std::string>(1) == "Hello");
+    CHECK(stmt.GetNullableColumn<int>(2) == 1);
+    CHECK(!stmt.GetNullableColumn<std::string>(3).has_value());
+    CHECK(stmt.GetColumn<std::string>(4) == "a");
+    CHECK(stmt.GetNullableColumn<SqlTime>(5) == fifth[0]);
+    CHECK(!stmt.GetNullableColumn<SqlDate>(6).has_value());
+
+    REQUIRE(stmt.FetchRow());
+    CHECK(stmt.GetColumn<std::string>(1) == "World!");
+    CHECK(stmt.GetNullableColumn<int>(2) == 3);
+    CHECK(stmt.GetNullableColumn<std::string>(3) == "x");
+    CHECK(stmt.GetColumn<std::string>(4) == "ccc");
+    CHECK(stmt.GetNullableColumn<SqlTime>(5) == fifth[2]);
+    CHECK(stmt.GetNullableColumn<SqlDate>(6) == sixth[2]);
+
+    REQUIRE(!stmt.FetchRow());
+
+    // The batch parameters must not leak into subsequent executions.
+    stmt.Prepare(R"(DELETE FROM "Test" WHERE "A" = ?)");
+    stmt.Execute("Hello");
+    CHECK(stmt.NumRowsAffected() == 1);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatchNative with long strings", "[SqlStatement]")
+{
+    auto stmt = SqlStatement {};
+    UNSUPPORTED_DATABASE(stmt, SqlServerType::ORACLE);
+
+    stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.CreateTable("Test")
+            .Column("A", SqlColumnTypeDefinitions::Integer {})
+            .Column("B", SqlColumnTypeDefinitions::Text {});
+    });
+
+    stmt.Prepare(R"(INSERT INTO "Test" ("A", "B") VALUES (?, ?))");
+
+    // The long strings would pad all rows beyond the byte budget, so the rows are executed in several chunks.
+    constexpr auto RowCount = 100;
+    constexpr auto LongLength = detail::MaxPackedStringBatchBytes / 8;
+    auto const first = std::views::iota(0, RowCount) | std::ranges::to<std::vector>();
+    auto const second = first | std::views::transform([&](int i) {
+                            return i % 25 == 10 ? std::string(LongLength, 'x') : std::format("row {}", i);
+                        })
+                        | std::ranges::to<std::vector>();
+    stmt.ExecuteBatchNative(first, second);
+
+    stmt.ExecuteDirect(R"(SELECT "A", "B" FROM "Test" ORDER BY "A")");
+    for (auto const& [a, b]: std::views::zip(first, second))
+    {
+        REQUIRE(stmt.FetchRow());
+        CHECK(stmt.GetColumn<int>(1) == a);
+        CHECK(stmt.GetColumn<std::string>(2) == b);
+    }
+    REQUIRE(!stmt.FetchRow());
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteInsertRows", "[SqlStatement]")
+{
+    auto stmt = SqlStatement {};
+    stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.CreateTable("Test")
+            .Column("A", SqlColumnTypeDefinitions::Integer {})
+            .Column("B", SqlColumnTypeDefinitions::Varchar { 16 })
+            .Column("C", SqlColumnTypeDefinitions::Integer {});
+    });
+
+    auto const& traits = stmt.Connection().Traits();
+    auto rowCount = std::size_t { 0 };
+
+    SECTION("multiple chunks")
+    {
+        // Spans multiple chunks, with a partially filled last chunk.
+        rowCount = 3 * traits.MaxInputParameterCount / 2 + 7;
+    }
+
+    SECTION("one full chunk")
+    {
+        // As many rows as fit into one statement, binding as many parameters as the server accepts,
+        // e.g. exactly 999 on SQLite (and 2097 on SQL Server, whose hard limit of 2100 includes its own).
+        rowCount = (std::min)(traits.MaxInputParameterCount / 3, traits.MaxInsertRowCount);
+    }
+
+    auto const first = std::views::iota(0, static_cast<int>(rowCount)) | std::ranges::to<std::vector>();
+    auto const second = first | std::views::transform([](int i) { return std::format("row {}", i); })
+                        | std::ranges::to<std::vector>();
+    auto const third = first | std::views::transform([](int i) -> std::optional<int> {
+                           return i % 2 ? std::optional { i } : std::nullopt;
+                       })
+                       | std::ranges::to<std::vector>();
+
+    auto const columnNames = std::array { "A"sv, "B"sv, "C"sv };
+    CHECK(stmt.ExecuteInsertRows("Test", columnNames, first, second, third) == rowCount);
+
+    stmt.ExecuteDirect(R"(SELECT "A", "B", "C" FROM "Test" ORDER BY "A")");
+    for (auto const i: first)
+    {
+        REQUIRE(stmt.FetchRow());
+        CHECK(stmt.GetColumn<int>(1) == i);
+        CHECK(stmt.GetColumn<std::string>(2) == std::format("row {}", i));
+        CHECK(stmt.GetNullableColumn<int>(3) == third[static_cast<std::size_t>(i)]);
+    }
+    REQUIRE(!stmt.FetchRow());
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteInsertRowsReturning", "[SqlStatement]")
+{
+    auto stmt = SqlStatement {};
+    if (stmt.Connection().ServerType() == SqlServerType::ORACLE)
+        return; // Oracle cannot return generated values from a multi-row INSERT
+
+    stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.CreateTable("Test")
+            .PrimaryKeyWithAutoIncrement("Id")
+            .Column("A", SqlColumnTypeDefinitions::Integer {});
+    });
+
+    // Leave a gap in the generated keys, which must not confuse the key retrieval.
+    stmt.ExecuteDirect(R"(INSERT INTO "Test" ("A") VALUES (-1))");
+    stmt.ExecuteDirect(R"(INSERT INTO "Test" ("A") VALUES (-2))");
+    stmt.ExecuteDirect(R"(DELETE FROM "Test" WHERE "A" = -2)");
+
+    // Spans multiple chunks, with a partially filled last chunk.
+    auto const rowCount = stmt.Connection().Traits().MaxInputParameterCount + 7;
+    auto const values = std::views::iota(0, static_cast<int>(rowCount)) | std::ranges::to<std::vector>();
+
+    auto const columnNames = std::array { "A"sv };
+    auto const keys = stmt.ExecuteInsertRowsReturning<int64_t>("Test", "Id", columnNames, values);
+    REQUIRE(keys.size() == rowCount);
+
+    stmt.ExecuteDirect(R"(SELECT "Id", "A" FROM "Test" WHERE "A" >= 0 ORDER BY "A")");
+    for (auto const [key, value]: std::views::zip(keys, values))
+    {
+        REQUIRE(stmt.FetchRow());
+        CHECK(stmt.GetColumn<int64_t>(1) == key);
+        CHECK(stmt.GetColumn<int>(2) == value);
+    }
+    REQUIRE(!stmt.FetchRow());
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.GetColumnView", "[SqlStatement]")
+{
+    auto stmt = SqlStatement {};
+    stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.CreateTable("Test")
+            .Column("A", SqlColumnTypeDefinitions::Varchar { 8 })
+            .Column("B", SqlColumnTypeDefinitions::Text {});
+    });
+
+    // Exceeds the initial buffer size of unlimited size columns, such that the buffer must grow.
+    auto const longText = std::string(10'000, 'x');
+
+    stmt.Prepare(R"(INSERT INTO "Test" ("A", "B") VALUES (?, ?))");
+    stmt.Execute("Hello", longText);
+    stmt.Execute("World", SqlNullValue);
+
+    stmt.ExecuteDirect(R"(SELECT "A", "B" FROM "Test" ORDER BY "A")");
+
+    REQUIRE(stmt.FetchRow());
+    CHECK(stmt.GetColumnView<std::string_view>(1) == "Hello");
+    CHECK(stmt.GetNullableColumnView<std::string_view>(2) == longText);
+
+    REQUIRE(stmt.FetchRow());
+    CHECK(stmt.GetColumnView<std::u16string_view>(1) == u"World");
+    CHECK(!stmt.GetNullableColumnView<std::string_view>(2).has_value());
+
+    REQUIRE(!stmt.FetchRow());
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.DescribeColumns", "[SqlStatement]")
+{
+    auto stmt = SqlStatement {};
+    stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.CreateTable("Test")
+            .RequiredColumn("A", SqlColumnTypeDefinitions::Varchar { 20 })
+            .Column("B", SqlColumnTypeDefinitions::Integer {});
+    });
+
+    stmt.Prepare(R"(SELECT "A", "B" FROM "Test")");
+    auto const columns = stmt.DescribeColumns();
+    REQUIRE(columns.size() == 2);
+    CHECK(columns[0].name == "A");
+    CHECK(columns[0].size == 20);
+    CHECK(!columns[0].nullable);
+    CHECK(columns[1].name == "B");
+    CHECK(columns[1].sqlType == SQL_INTEGER);
+
+    // The columns are described only once per prepared query.
+    CHECK(stmt.DescribeColumns().data() == columns.data());
+
+    stmt.ExecuteDirect(R"(SELECT "B" FROM "Test")");
+    REQUIRE(stmt.DescribeColumns().size() == 1);
+    CHECK(stmt.DescribeColumns()[0].name == "B");
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.FetchRows", "[SqlStatement]")
+{
+    auto stmt = SqlStatement {};
+    stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.CreateTable("Test")
+            .Column("A", SqlColumnTypeDefinitions::Integer {})
+            .Column("B", SqlColumnTypeDefinitions::Real {});
+    });
+
+    stmt.Prepare(R"(INSERT INTO "Test" ("A", "B") VALUES (?, ?))");
+    for (auto const i: std::views::iota(0, 10))
+        stmt.Execute(i, i * 0.5);
+
+    stmt.ExecuteDirect(R"(SELECT "A", "B" FROM "Test" ORDER BY "A")");
+
+    auto a = std::vector<int>(4);
+    auto b = std::vector<double>(4);
+    auto fetchedA = std::vector<int> {};
+    auto rowCounts = std::vector<size_t> {};
+
+    while (auto const rowCount = stmt.FetchRows(a, b))
+    {
+        rowCounts.push_back(rowCount);
+        for (auto const row: std::views::iota(size_t { 0 }, rowCount))
+        {
+            CHECK(!stmt.IsNullInFetchedRows(1, row));
+            CHECK_THAT(b[row], Catch::Matchers::WithinAbs(a[row] * 0.5, 0.000'001));
+            fetchedA.push_back(a[row]);
+        }
+    }
+
+    CHECK(rowCounts == std::vector<size_t> { 4, 4, 2 });
+    CHECK(fetchedA == std::vector<int> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+
+    // Single row fetching works again after block fetching.
+    stmt.ExecuteDirect(R"(SELECT COUNT(*) FROM "Test")");
+    REQUIRE(stmt.FetchRow());
+    CHECK(stmt.GetColumn<int>(1) == 10);
+}
+
+static SqlTask<std::vector<int>> FetchAllAsync(SqlReactor& reactor, SqlStatement& stmt, std::string query)
+{
+    co_await stmt.ExecuteDirectAsync(reactor, std::move(query));
+
+    auto values = std::vector<int> {};
+    while (co_await stmt.FetchRowAsync(reactor))
+        values.push_back(stmt.GetColumn<int>(1));
+    co_return values;
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteAsync", "[SqlStatement],[SqlReactor]")
+{
+    auto reactor = SqlReactor {};
+    auto stmt = SqlStatement {};
+    stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.CreateTable("Test")
+            .Column("A", SqlColumnTypeDefinitions::Integer {})
+            .Column("B", SqlColumnTypeDefinitions::Varchar { 16 });
+    });
+
+    stmt.Prepare(R"(INSERT INTO "Test" ("A", "B") VALUES (?, ?))");
+    for (auto const i: { 1, 2 })
+        reactor.RunUntilComplete(stmt.ExecuteAsync(reactor, i, std::to_string(i)));
+
+    // The task owns its arguments, so it may run long after the temporaries it was created from are gone.
+    auto task = stmt.ExecuteAsync(reactor, 3, std::string("three"));
+    reactor.RunUntilComplete(std::move(task));
+
+    auto const values =
+        reactor.RunUntilComplete(FetchAllAsync(reactor, stmt, R"(SELECT "A" FROM "Test" ORDER BY "A")"));
+    CHECK(values == std::vector<int> { 1, 2, 3 });
+    CHECK(reactor.PendingCount() == 0);
+
+    stmt.ExecuteDirect(R"(SELECT "B" FROM "Test" WHERE "A" = 3)");
+    REQUIRE(stmt.FetchRow());
+    CHECK(stmt.GetColumn<std::string>(1) == "three");
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlReactor: multiplex statements", "[SqlReactor]")
+{
+    auto reactor = SqlReactor {};
+    auto statements = std::vector<SqlStatement>(4); // Each on its own connection, to execute concurrently
+
+    auto results = std::vector<std::vector<int>>(statements.size());
+    auto const fetchInto =
+        [](SqlReactor& reactor, SqlStatement& stmt, std::vector<int>& result, int value) -> SqlTask<> {
+        result = co_await FetchAllAsync(reactor, stmt, std::format("SELECT {}", value));
+    };
+    for (auto const [i, stmt]: statements | std::views::enumerate)
+        reactor.Spawn(fetchInto(reactor, stmt, results[i], static_cast<int>(i)));
+    reactor.Run();
+
+    for (auto const [i, result]: results | std::views::enumerate)
+        CHECK(result == std::vector<int> { static_cast<int>(i) });
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlReactor: failing task while another call is in flight", "[SqlReactor]")
+{
+    auto reactor = SqlReactor {};
+    auto failingStmt = SqlStatement {};
+    auto inFlightStmt = SqlStatement {}; // On its own connection, to execute concurrently
+
+    auto const failAfterQuery = [](SqlReactor& reactor, SqlStatement& stmt) -> SqlTask<> {
+        (void) co_await FetchAllAsync(reactor, stmt, "SELECT 1");
+        throw std::runtime_error("task failed");
+    };
+
+    // Drivers without asynchronous execution complete the failing task synchronously within Spawn(),
+    // otherwise its exception is rethrown by RunOnce() while the other query may still be in flight.
+    CHECK_THROWS_AS(
+        [&] {
+            reactor.Spawn(failAfterQuery(reactor, failingStmt));
+            (void) reactor.RunUntilComplete(FetchAllAsync(reactor, inFlightStmt, "SELECT 42"));
+        }(),
+        std::runtime_error);
+
+    // The call in flight has been cancelled and unregistered, leaving no dangling awaiter behind.
+    CHECK(reactor.PendingCount() == 0);
+
+    // Both the reactor and the cancelled statement remain usable.
+    auto const values = reactor.RunUntilComplete(FetchAllAsync(reactor, inFlightStmt, "SELECT 42"));
+    CHECK(values == std::vector<int> { 42 });
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlLogger: event mask", "[SqlLogger]")
+{
+    struct CountingLogger: ScopedSqlNullLogger
+    {
+        int executeCount = 0;
+        int fetchRowCount = 0;
+
+        void OnExecuteDirect(std::string_view const& /*query*/) override
+        {
+            ++executeCount;
+        }
+
+        void OnFetchRow() override
+        {
+            ++fetchRowCount;
+        }
+    };
+
+    auto logger = CountingLogger {};
+    CHECK(SqlLogger::GetEventMask() == SqlLogger::Event::ALL);
+
+    auto stmt = SqlStatement {};
+    auto const executeAndFetch = [&] {
+        stmt.ExecuteDirect("SELECT 42");
+        while (stmt.FetchRow())
+            ;
+    };
+
+    SECTION("all events")
+    {
+        executeAndFetch();
+        CHECK(logger.executeCount == (LIGHTWEIGHT_SQL_LOGGING ? 1 : 0));
+        CHECK(logger.fetchRowCount == (LIGHTWEIGHT_SQL_LOGGING ? 1 : 0));
+    }
+
+    SECTION("fetch events masked out")
+    {
+        SqlLogger::SetEventMask(SqlLogger::Event::ALL & ~SqlLogger::Event::FETCH);
+        executeAndFetch();
+        CHECK(logger.executeCount == (LIGHTWEIGHT_SQL_LOGGING ? 1 : 0));
+        CHECK(logger.fetchRowCount == 0);
+    }
+}
+
+namespace
+{
+
+#if defined(_WIN32) || defined(_WIN64)
+int StdoutFd()
+{
+    return _fileno(stdout);
+}
+
+int DuplicateFd(int fd)
+{
+    return _dup(fd);
+}
+
+void RestoreFd(int savedFd, int fd)
+{
+    _dup2(savedFd, fd);
+    _close(savedFd);
+}
+
+int ProcessId()
+{
+    return _getpid();
+}
+#else
+int StdoutFd()
+{
+    return fileno(stdout);
+}
+
+int DuplicateFd(int fd)
+{
+    return dup(fd);
+}
+
+void RestoreFd(int savedFd, int fd)
+{
+    dup2(savedFd, fd);
+    close(savedFd);
+}
+
+int ProcessId()
+{
+    return static_cast<int>(getpid());
+}
+#endif
+
+// Redirects the standard output into a temporary file for the lifetime of this object.
+class ScopedStdoutCapture
+{
+  public:
+    ScopedStdoutCapture():
+        // Unique per process, as concurrently running tests would overwrite each other's captures otherwise.
+        _path { std::filesystem::temp_directory_path()
+                / std::format("Lightweight-stdout-capture-{}.log", ProcessId()) }
+    {
+        std::fflush(stdout);
+        _savedFd = DuplicateFd(StdoutFd());
+        REQUIRE(std::freopen(_path.string().c_str(), "w", stdout) != nullptr);
+    }
+
+    ScopedStdoutCapture(ScopedStdoutCapture const&) = delete;
+    ScopedStdoutCapture(ScopedStdoutCapture&&) = delete;
+    ScopedStdoutCapture& operator=(ScopedStdoutCapture const&) = delete;
+    ScopedStdoutCapture& operator=(ScopedStdoutCapture&&) = delete;
+
+    ~ScopedStdoutCapture()
+    {
+        Restore();
+        std::filesystem::remove(_path);
+    }
+
+    // Restores the standard output and retrieves the lines written in the meantime.
+    std::vector<std::string> Lines()
+    {
+        Restore();
+        auto file = std::ifstream { _path };
+        auto lines = std::vector<std::string> {};
+        for (auto line = std::string {}; std::getline(file, line);)
+            lines.emplace_back(std::move(line));
+        return lines;
+    }
+
+  private:
+    void Restore()
+    {
+        if (_savedFd < 0)
+            return;
+        std::fflush(stdout);
+        RestoreFd(_savedFd, StdoutFd());
+        _savedFd = -1;
+    }
+
+    std::filesystem::path _path;
+    int _savedFd = -1;
+};
+
+} // namespace
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlLogger: concurrent logging", "[SqlLogger]")
+{
+    if (!LIGHTWEIGHT_SQL_LOGGING)
+        return;
+
+    constexpr auto ThreadCount = 8;
+    constexpr auto LinesPerThread = 500;
+    auto const payload = std::string(200, 'x');
+
+    auto capture = ScopedStdoutCapture {};
+    auto& logger = SqlLogger::TraceLogger();
+    {
+        auto threads = std::vector<std::jthread> {};
+        for (auto const thread: std::views::iota(0, ThreadCount))
+            threads.emplace_back([&, thread] {
+                for (auto const i: std::views::iota(0, LinesPerThread))
+                {
+                    logger.OnWarning(std::format("thread {} line {} {}", thread, i, payload));
+                    if (i % 100 == 0)
+                        logger.OnError(SqlErrorInfo { .nativeErrorCode = thread, .sqlState = "42000", .message = "" });
+                }
+            });
+    }
+    logger.Flush();
+    auto const lines = capture.Lines();
+
+    auto seen = std::set<std::string> {};
+    auto errorCount = 0;
+    for (auto const [index, line]: lines | std::views::enumerate)
+    {
+        if (auto const pos = line.find("Warning: thread "); pos != std::string::npos)
+        {
+            // Each line is complete, and not interleaved with another one.
+            CHECK(line.ends_with(" " + payload));
+            CHECK(seen.insert(line.substr(pos)).second);
+        }
+        else if (line.ends_with("SQL Error:"))
+        {
+            // The error and its details are written as one entry, without another thread's line in between.
+            ++errorCount;
+            REQUIRE(static_cast<std::size_t>(index) + 4 < lines.size());
+            CHECK(lines[index + 1].starts_with("  SQLSTATE: 42000"));
+            CHECK(lines[index + 2].starts_with("  Native error code: "));
+            CHECK(lines[index + 3].starts_with("  Message: "));
+            CHECK(lines[index + 4].starts_with("  Source: "));
+        }
+    }
+    CHECK(seen.size() == ThreadCount * LinesPerThread);
+    CHECK(errorCount == ThreadCount * (LinesPerThread / 100));
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "SqlConnection: manual connect", "[SqlConnection]")
 {
     auto conn = SqlConnection { std::nullopt };
@@ -321,6 +941,122 @@ TEST_CASE_METHOD(SqlTestFixture, "SqlConnection: manual connect (invalid)", "[Sq
     CHECK(!conn.IsAlive());
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "SqlConnection: shared environment", "[SqlConnection]")
+{
+    auto a = SqlConnection {};
+    {
+        auto b = SqlConnection {};
+        CHECK(b.IsAlive());
+    }
+
+    // Closing `b` must not release the environment still in use by `a`.
+    CHECK(a.IsAlive());
+    auto stmt = SqlStatement { a };
+    CHECK(stmt.ExecuteDirectScalar<int>("SELECT 42").value() == 42);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlConnectionPool: reuse", "[SqlConnectionPool]")
+{
+    auto pool = SqlConnectionPool { SqlConnectionPoolConfig { .maxConnections = 2 } };
+    auto const& connectionString = SqlConnection::DefaultConnectionString();
+
+    uint64_t connectionId {};
+    {
+        auto conn = pool.Acquire(connectionString);
+        REQUIRE(conn.IsAlive());
+        connectionId = conn.ConnectionId();
+        CHECK(pool.IdleCount(connectionString) == 0);
+        CHECK(pool.TotalCount(connectionString) == 1);
+    }
+
+    // Closing the connection (via destructor) puts it back into the pool.
+    CHECK(pool.IdleCount(connectionString) == 1);
+
+    auto conn = pool.Acquire(connectionString);
+    CHECK(conn.ConnectionId() == connectionId);
+    CHECK(conn.IsAlive());
+    CHECK(pool.IdleCount(connectionString) == 0);
+
+    SECTION("statement on the reused connection")
+    {
+        auto stmt = SqlStatement { conn };
+        CHECK(stmt.ExecuteDirectScalar<int>("SELECT 42").value() == 42);
+    }
+
+    SECTION("explicit Close() leaves a valid, disconnected object behind")
+    {
+        conn.Close();
+        CHECK(pool.IdleCount(connectionString) == 1);
+        CHECK(!conn.IsAlive());
+        CHECK(conn.ConnectionString().value.empty());
+        CHECK(conn.StatementCache().Size() == 0);
+        conn.SetLastUsed(std::chrono::steady_clock::now());
+        CHECK(conn.LastUsed() != std::chrono::steady_clock::time_point {});
+    }
+
+    SECTION("move-assigning over the connection puts it back into the pool")
+    {
+        conn = SqlConnection { std::nullopt };
+        CHECK(pool.IdleCount(connectionString) == 1);
+        CHECK(!conn.IsAlive());
+    }
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlConnectionPool: reap idle connections", "[SqlConnectionPool]")
+{
+    auto pool = SqlConnectionPool { SqlConnectionPoolConfig {
+        .minIdleConnections = 1,
+        .idleTimeout = std::chrono::milliseconds(0),
+        .reapInterval = std::chrono::milliseconds(0),
+    } };
+    auto const& connectionString = SqlConnection::DefaultConnectionString();
+
+    {
+        auto a = pool.Acquire(connectionString);
+        auto b = pool.Acquire(connectionString);
+        CHECK(a.ConnectionId() != b.ConnectionId());
+    }
+    CHECK(pool.IdleCount(connectionString) == 2);
+
+    pool.Reap();
+    CHECK(pool.IdleCount(connectionString) == 1);
+    CHECK(pool.TotalCount(connectionString) == 1);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlConnectionPool: exhausted", "[SqlConnectionPool]")
+{
+    auto pool = SqlConnectionPool { SqlConnectionPoolConfig {
+        .maxConnections = 1,
+        .acquireTimeout = std::chrono::milliseconds(10),
+    } };
+
+    auto conn = pool.Acquire();
+    auto const _ = ScopedSqlNullLogger {};
+    CHECK_THROWS_AS(pool.Acquire(), SqlException);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlQueryExecutor", "[SqlQueryExecutor]")
+{
+    auto pool = SqlConnectionPool { SqlConnectionPoolConfig { .maxConnections = 2 } };
+    auto executor = SqlQueryExecutor { pool, { .concurrency = 2, .queueCapacity = 4 } };
+
+    auto futures = std::vector<std::future<int>> {};
+    for (auto const i: std::views::iota(0, 10))
+        futures.emplace_back(executor.Submit([i](SqlConnection& connection) {
+            return SqlStatement { connection }.ExecuteDirectScalar<int>(std::format("SELECT {}", i)).value();
+        }));
+
+    for (auto const [i, future]: futures | std::views::enumerate)
+        CHECK(future.get() == i);
+
+    // Exceptions thrown by a query are delivered via its future.
+    auto failed = executor.Submit([](SqlConnection&) -> int { throw std::runtime_error { "failed" }; });
+    CHECK_THROWS_AS(failed.get(), std::runtime_error);
+
+    CHECK(executor.QueuedCount() == 0);
+    CHECK(pool.TotalCount(SqlConnection::DefaultConnectionString()) <= 2);
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "LastInsertId", "[SqlStatement]")
 {
     auto stmt = SqlStatement {};
@@ -332,6 +1068,73 @@ TEST_CASE_METHOD(SqlTestFixture, "LastInsertId", "[SqlStatement]")
     REQUIRE(stmt.LastInsertId("Employees") == 3);
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatementCache", "[SqlStatement]")
+{
+    auto conn = SqlConnection {};
+    auto& cache = conn.StatementCache();
+    cache.SetCapacity(4);
+
+    auto const selectScalar = [&](std::string_view query) {
+        auto stmt = SqlStatement { conn };
+        stmt.Prepare(query);
+        stmt.Execute();
+        REQUIRE(stmt.FetchRow());
+        auto const value = stmt.GetColumn<int>(1);
+        REQUIRE(!stmt.FetchRow());
+        return value;
+    };
+
+    CHECK(selectScalar("SELECT 42") == 42);
+    CHECK(cache.Misses() == 1);
+    CHECK(cache.Hits() == 0);
+    CHECK(cache.Size() == 1);
+
+    CHECK(selectScalar("SELECT 43") == 43);
+    CHECK(cache.Misses() == 2);
+    CHECK(cache.Size() == 2);
+
+    CHECK(selectScalar("SELECT 42") == 42);
+    CHECK(cache.Hits() == 1);
+    CHECK(cache.Size() == 2);
+
+    cache.SetCapacity(1);
+    CHECK(cache.Size() == 1);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatementCache: cache hit does not leak handles", "[SqlStatement]")
+{
+    auto conn = SqlConnection {};
+    auto& cache = conn.StatementCache();
+    cache.SetCapacity(4);
+
+    {
+        auto stmt = SqlStatement { conn };
+        stmt.Prepare("SELECT 42");
+    }
+    REQUIRE(cache.Size() == 1);
+    auto const handleCount = cache.AllocatedHandles();
+
+    SECTION("fresh statement")
+    {
+        auto stmt = SqlStatement { conn };
+        stmt.Prepare("SELECT 42");
+        CHECK(cache.Hits() == 1);
+        CHECK(cache.AllocatedHandles() == handleCount);
+    }
+
+    SECTION("after ExecuteDirect")
+    {
+        auto stmt = SqlStatement { conn };
+        stmt.ExecuteDirect("SELECT 43");
+        stmt.CloseCursor();
+        stmt.Prepare("SELECT 42");
+        CHECK(cache.Hits() == 1);
+        CHECK(cache.AllocatedHandles() == handleCount);
+    }
+
+    CHECK(cache.AllocatedHandles() == handleCount);
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "SELECT * FROM Table", "[SqlStatement]")
 {
     auto stmt = SqlStatement {};
@@ -20,10 +20,12 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstdlib>
 #include <format>
 #include <numbers>
 #include <ranges>
+#include <sstream>
 #include <type_traits>
 
 // NOLINTBEGIN(readability-container-size-empty)
@@ -69,7 +71,17 @@ struct SqlDataBinder<CustomType>
                                   SQLLEN* indicator,
                                   SqlDataBinderCallback& callback) noexcept
     {
-        callback.PlanPostProcessOutputColumn([result]() { result->value = PostProcess(result->value); });
+        callback.PlanPostProcessOutputColumn(SqlOutputColumnFixup {
+            .postProcess =
+                [](SqlOutputColumnFixup& fixup) {
+                    auto* const result = static_cast<CustomType*>(fixup.result);
+                    result->value = PostProcess(result->value);
+                },
+            .stmt = hStmt,
+            .column = column,
+            .result = result,
+            .indicator = indicator,
+        });
         return SqlDataBinder<int>::OutputColumn(hStmt, column, &result->value, indicator, callback);
     }
 
@@ -336,6 +348,62 @@ TEST_CASE_METHOD(SqlTestFixture, "InputParameter and GetColumn for very large va
     }
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "SqlInputStream and SqlOutputStream", "[SqlDataBinder]")
+{
+    auto stmt = SqlStatement {};
+    UNSUPPORTED_DATABASE(stmt, SqlServerType::ORACLE);
+
+    // Larger than a single chunk of SqlInputStream, to be put in multiple pieces
+    auto expectedText = std::string(200'000, '\0');
+    std::ranges::generate(expectedText, [i = 0]() mutable { return char('A' + (i++ % 26)); });
+
+    stmt.MigrateDirect([size = expectedText.size()](auto& migration) {
+        migration.CreateTable("Test").Column("Value", SqlColumnTypeDefinitions::Text { size });
+    });
+    stmt.Prepare(stmt.Query("Test").Insert().Set("Value", SqlWildcard));
+
+    auto input = std::istringstream { expectedText };
+    stmt.Execute(SqlInputStream::From(input, SqlStreamType::TEXT));
+
+    stmt.ExecuteDirect(stmt.Query("Test").Select().Field("Value").All());
+    REQUIRE(stmt.FetchRow());
+
+    auto output = std::ostringstream {};
+    auto sink = SqlOutputStream::To(output, SqlStreamType::TEXT);
+    sink.chunkSize = 1000;
+    CHECK(stmt.GetColumn(1, &sink));
+    CHECK(output.str() == expectedText);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlInputStream in multi-row inserts", "[SqlDataBinder]")
+{
+    auto stmt = SqlStatement {};
+    UNSUPPORTED_DATABASE(stmt, SqlServerType::ORACLE);
+
+    stmt.MigrateDirect([](auto& migration) {
+        migration.CreateTable("Test")
+            .Column("Id", SqlColumnTypeDefinitions::Integer {})
+            .Column("Value", SqlColumnTypeDefinitions::Text {});
+    });
+
+    // Each row's stream is put at execution time, as with Execute().
+    auto const expectedTexts = std::array { std::string(50'000, 'a'), std::string(70'000, 'b') };
+    auto inputs = std::array { std::istringstream { expectedTexts[0] }, std::istringstream { expectedTexts[1] } };
+    auto const ids = std::array { 1, 2 };
+    auto const streams = std::array { SqlInputStream::From(inputs[0], SqlStreamType::TEXT),
+                                      SqlInputStream::From(inputs[1], SqlStreamType::TEXT) };
+    auto const columnNames = std::array { "Id"sv, "Value"sv };
+    CHECK(stmt.ExecuteInsertRows("Test", columnNames, ids, streams) == 2);
+
+    stmt.ExecuteDirect(R"(SELECT "Value" FROM "Test" ORDER BY "Id")");
+    for (auto const& expectedText: expectedTexts)
+    {
+        REQUIRE(stmt.FetchRow());
+        CHECK(stmt.GetColumn<std::string>(1) == expectedText);
+    }
+    REQUIRE(!stmt.FetchRow());
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "SqlDataBinder: Unicode", "[SqlDataBinder],[Unicode]")
 {
     auto stmt = SqlStatement {};
@@ -3,15 +3,28 @@
 #include "Lightweight/Utils.hpp"
 #include "Utils.hpp"
 
+#include <Lightweight/DataMapper/BulkLoader.hpp>
 #include <Lightweight/DataMapper/DataMapper.hpp>
+#include <Lightweight/DataMapper/ParallelScan.hpp>
 
 #include <reflection-cpp/reflection.hpp>
 
 #include <catch2/catch_session.hpp>
+#include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <algorithm>
+#include <filesystem>
 #include <iostream>
+#include <mutex>
+#include <optional>
 #include <ostream>
+#include <ranges>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
 
 using namespace std::string_view_literals;
 
@@ -122,6 +135,464 @@ TEST_CASE_METHOD(SqlTestFixture, "CRUD", "[DataMapper]")
     CHECK(!dm.QuerySingle<Person>(person.id));
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "RecordStatementsOf", "[DataMapper]")
+{
+    auto const& statements = RecordStatementsOf<Person>(SqlServerType::SQLITE);
+
+    CHECK(statements.insertAll == R"(INSERT INTO "Person" ("id", "name", "is_active", "age") VALUES (?, ?, ?, ?))");
+    CHECK(statements.selectByPrimaryKey
+          == "SELECT \"id\", \"name\", \"is_active\", \"age\" FROM \"Person\"\n WHERE \"id\" = ? LIMIT 1");
+    CHECK(statements.deleteByPrimaryKey == "DELETE FROM \"Person\"\n WHERE \"id\" = ?");
+    CHECK(statements.selectAll == R"(SELECT "id", "name", "is_active", "age" FROM "Person")");
+    CHECK(statements.upsert
+          == R"(INSERT INTO "Person" ("id", "name", "is_active", "age") VALUES (?, ?, ?, ?) ON CONFLICT ("id"))"
+             R"( DO UPDATE SET "name" = excluded."name", "is_active" = excluded."is_active", "age" = excluded."age")");
+
+    // The statements are built only once per record type and server type.
+    CHECK(&statements == &RecordStatementsOf<Person>(SqlServerType::SQLITE));
+    CHECK(&statements != &RecordStatementsOf<Person>(SqlServerType::POSTGRESQL));
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "All", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+
+    auto john = Person {};
+    john.name = "John Doe";
+    dm.Create(john);
+
+    auto jane = Person {};
+    jane.name = "Jane Doe";
+    dm.Create(jane);
+
+    auto const records = dm.All<Person>();
+    REQUIRE(records.size() == 2);
+    CHECK(records[0].name.Value() != records[1].name.Value());
+}
+
+struct Measurement
+{
+    Field<uint64_t, PrimaryKey::ServerSideAutoIncrement> id {};
+    Field<int> sensor {};
+    Field<double> value {};
+};
+
+struct SparseMeasurement
+{
+    Field<uint64_t, PrimaryKey::ServerSideAutoIncrement> id {};
+    Field<std::optional<int>> sensor {};
+    Field<double> value {};
+};
+
+// Creates the i-th record of a series of measurements, leaving the sensor of every third one unset.
+template <typename Record>
+static Record MakeMeasurement(int i)
+{
+    auto record = Record {};
+    if (i % 3 != 0)
+        record.sensor = i;
+    record.value = i * 0.5;
+    return record;
+}
+
+// Checks that the given records, as queried by primary key order, are the series created by MakeMeasurement().
+template <typename Record>
+static void CheckMeasurements(std::vector<Record> const& records, std::size_t expectedCount)
+{
+    REQUIRE(records.size() == expectedCount);
+    for (auto const& [i, record]: records | std::views::enumerate)
+    {
+        CHECK(record.id.Value() == static_cast<uint64_t>(i + 1));
+        CHECK_THAT(record.value.Value(), Catch::Matchers::WithinAbs(static_cast<double>(i) * 0.5, 0.000'001));
+        if constexpr (std::same_as<Record, SparseMeasurement>)
+            CHECK(record.sensor.Value() == (i % 3 != 0 ? std::optional { static_cast<int>(i) } : std::nullopt));
+        else
+            CHECK(record.sensor.Value() == (i % 3 != 0 ? static_cast<int>(i) : 0));
+    }
+}
+
+TEMPLATE_TEST_CASE_METHOD(SqlTestFixture, "Query bulk fetch", "[DataMapper]", Measurement, SparseMeasurement)
+{
+    using Record = TestType;
+
+    if constexpr (std::same_as<Record, Measurement>)
+        static_assert(detail::RecordFetchModeOf<Record> == detail::RecordFetchMode::RowWise);
+    else
+        static_assert(detail::RecordFetchModeOf<Record> == detail::RecordFetchMode::ColumnWise);
+    static_assert(detail::RecordFetchModeOf<Person> == detail::RecordFetchMode::RowByRow);
+
+    auto dm = DataMapper();
+    dm.CreateTable<Record>();
+
+    // Spans multiple fetch blocks, with a partially filled last block.
+    constexpr auto RecordCount = 2500;
+    for (auto const i: std::views::iota(0, RecordCount))
+    {
+        auto record = MakeMeasurement<Record>(i);
+        dm.Create(record);
+    }
+
+    auto const records = dm.All<Record>();
+    CheckMeasurements(records, RecordCount);
+    for (auto const& record: records)
+        CHECK(!dm.IsModified(record));
+}
+
+TEMPLATE_TEST_CASE_METHOD(SqlTestFixture, "CreateAll", "[DataMapper]", Measurement, SparseMeasurement)
+{
+    using Record = TestType;
+
+    static_assert(detail::IsRowWiseInsertable<Record> == std::same_as<Record, Measurement>);
+
+    auto dm = DataMapper();
+    dm.CreateTable<Record>();
+
+    auto records = std::vector<Record>(100);
+    for (auto&& [i, record]: records | std::views::enumerate)
+        record = MakeMeasurement<Record>(static_cast<int>(i));
+
+    dm.CreateAll(std::span { records });
+
+    for (auto const& [i, record]: records | std::views::enumerate)
+    {
+        CHECK(record.id.Value() == static_cast<uint64_t>(i + 1));
+        CHECK(!dm.IsModified(record));
+    }
+
+    auto const queriedRecords = dm.All<Record>();
+    REQUIRE(queriedRecords.size() == records.size());
+    for (auto const& [record, queriedRecord]: std::views::zip(records, queriedRecords))
+    {
+        CHECK(queriedRecord.id.Value() == record.id.Value());
+        CHECK(queriedRecord.sensor.Value() == record.sensor.Value());
+        CHECK_THAT(queriedRecord.value.Value(), Catch::Matchers::WithinAbs(record.value.Value(), 0.000'001));
+    }
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "CreateAll with auto-assigned primary keys", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+
+    auto people = std::vector<Person>(3);
+    people[0].name = "Alice";
+    people[1].name = "Bob";
+    people[2].name = "Charlie";
+    people[2].age = 42;
+
+    dm.CreateAll(std::span { people });
+
+    for (auto const& person: people)
+    {
+        REQUIRE(person.id.Value());
+        auto const queriedPerson = dm.QuerySingle<Person>(person.id).value();
+        CHECK(queriedPerson.name == person.name);
+        CHECK(queriedPerson.age.Value() == person.age.Value());
+    }
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "Save", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+
+    auto person = Person {};
+    person.name = "John Doe";
+    dm.Save(person);
+    REQUIRE(person.id.Value());
+    CHECK(!dm.IsModified(person));
+    CHECK(dm.Count<Person>() == 1);
+
+    person.age = 42;
+    dm.Save(person);
+    CHECK(dm.Count<Person>() == 1);
+    CHECK(dm.QuerySingle<Person>(person.id).value().age.Value() == 42);
+
+    SECTION("SaveAll")
+    {
+        auto people = std::vector<Person>(2);
+        people[0] = person;
+        people[0].name = "Jane Doe";
+        people[1].name = "Jim Doe";
+
+        dm.SaveAll(std::span { people });
+        CHECK(people[1].id.Value());
+        CHECK(dm.Count<Person>() == 2);
+        CHECK(dm.QuerySingle<Person>(person.id).value().name.Value() == "Jane Doe");
+        CHECK(dm.QuerySingle<Person>(people[1].id).value().name.Value() == "Jim Doe");
+    }
+}
+
+TEMPLATE_TEST_CASE_METHOD(SqlTestFixture, "UpdateAll", "[DataMapper]", Measurement, SparseMeasurement)
+{
+    using Record = TestType;
+
+    static_assert(detail::IsBatchUpdatable<Record>);
+    static_assert(!detail::IsBatchUpdatable<Person>);
+
+    auto dm = DataMapper();
+    dm.CreateTable<Record>();
+
+    auto records = std::vector<Record>(10);
+    for (auto&& [i, record]: records | std::views::enumerate)
+    {
+        record.sensor = static_cast<int>(i);
+        record.value = static_cast<double>(i);
+    }
+    dm.CreateAll(std::span { records });
+
+    // Two groups of records with different modified fields, and one unmodified record.
+    for (auto&& [i, record]: records | std::views::enumerate | std::views::drop(1))
+    {
+        record.value = static_cast<double>(i) * 10;
+        if (i % 2 == 0)
+            record.sensor = static_cast<int>(i) + 100;
+    }
+
+    dm.UpdateAll(std::span { records });
+
+    for (auto const& record: records)
+        CHECK(!dm.IsModified(record));
+
+    auto const queriedRecords = dm.All<Record>();
+    REQUIRE(queriedRecords.size() == records.size());
+    for (auto const& [record, queriedRecord]: std::views::zip(records, queriedRecords))
+    {
+        CHECK(queriedRecord.id.Value() == record.id.Value());
+        CHECK(queriedRecord.sensor.Value() == record.sensor.Value());
+        CHECK_THAT(queriedRecord.value.Value(), Catch::Matchers::WithinAbs(record.value.Value(), 0.000'001));
+    }
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "UpdateAll failing in a later group", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Measurement>();
+    SqlStatement(dm.Connection()).MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.AlterTable("Measurement").AddUniqueIndex("sensor");
+    });
+
+    auto records = std::vector<Measurement>(3);
+    for (auto&& [i, record]: records | std::views::enumerate)
+    {
+        record.sensor = static_cast<int>(i);
+        record.value = static_cast<double>(i);
+    }
+    dm.CreateAll(std::span { records });
+
+    // The first group only modifies the value, and succeeds.
+    records[0].value = 42.0;
+
+    // The second group also modifies the sensor, and violates its unique index.
+    records[1].sensor = records[2].sensor.Value();
+    records[1].value = 43.0;
+
+    CHECK_THROWS_AS(dm.UpdateAll(std::span { records }), SqlException);
+
+    // The update of the first group has been rolled back, and so its records are still modified.
+    CHECK(dm.IsModified(records[0]));
+    CHECK(dm.IsModified(records[1]));
+    CHECK(!dm.IsModified(records[2]));
+    CHECK(dm.QuerySingle<Measurement>(records[0].id).value().value.Value() == 0.0);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "UpdateAll with a modified primary key", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Measurement>();
+
+    auto records = std::vector<Measurement>(2);
+    dm.CreateAll(std::span { records });
+
+    records[0].value = 42.0;
+    records[1].id = records[1].id.Value() + 100;
+
+    // Rejected before anything is updated.
+    CHECK_THROWS_AS(dm.UpdateAll(std::span { records }), std::invalid_argument);
+    CHECK(dm.IsModified(records[0]));
+    CHECK(dm.QuerySingle<Measurement>(records[0].id).value().value.Value() == 0.0);
+    CHECK(dm.Count<Measurement>() == 2);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "DeleteAll", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Measurement>();
+
+    // Spans multiple IN lists, with a partially filled last one.
+    auto records = std::vector<Measurement>(DataMapper::InListChunkSize * 2 + 100);
+    dm.CreateAll(std::span { records });
+
+    SECTION("by records")
+    {
+        CHECK(dm.DeleteAll<Measurement>(records | std::views::drop(100)) == records.size() - 100);
+        CHECK(dm.Count<Measurement>() == 100);
+    }
+
+    SECTION("by primary keys")
+    {
+        auto const ids = records | std::views::take(100)
+                         | std::views::transform([](Measurement const& record) { return record.id.Value(); })
+                         | std::ranges::to<std::vector>();
+        CHECK(dm.DeleteAll<Measurement>(ids) == 100);
+        CHECK(dm.DeleteAll<Measurement>(ids) == 0);
+        CHECK(dm.Count<Measurement>() == records.size() - 100);
+    }
+}
+
+TEMPLATE_TEST_CASE_METHOD(SqlTestFixture, "SqlBulkLoader", "[DataMapper]", Measurement, SparseMeasurement)
+{
+    using Record = TestType;
+
+    auto dm = DataMapper();
+    dm.CreateTable<Record>();
+
+    auto method = SqlBulkLoadMethod {};
+    SECTION("parameter arrays")
+    {
+        method = SqlBulkLoadMethod::PARAMETER_ARRAYS;
+    }
+    SECTION("multi-row VALUES")
+    {
+        method = SqlBulkLoadMethod::MULTI_ROW_VALUES;
+    }
+
+    auto loader = SqlBulkLoader<Record> {
+        dm.Connection(),
+        { .batchSize = 1000, .commitInterval = 2000, .method = method },
+    };
+
+    // Spans multiple batches and commit intervals, with a partially filled last batch.
+    constexpr auto RecordCount = 2500;
+    for (auto const i: std::views::iota(0, RecordCount))
+        loader.Add(MakeMeasurement<Record>(i));
+    CHECK(loader.RowsLoaded() == 2000);
+    CHECK(loader.Finish() == RecordCount);
+
+    CheckMeasurements(dm.All<Record>(), RecordCount);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlBulkLoader rolls back unfinished loads", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Measurement>();
+
+    {
+        auto loader = SqlBulkLoader<Measurement> { dm.Connection(), { .batchSize = 10, .commitInterval = 0 } };
+        loader.AddAll(std::vector<Measurement>(25));
+        CHECK(loader.RowsLoaded() == 20);
+    }
+
+    CHECK(dm.Count<Measurement>() == 0);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlBulkLoader discards a failed batch", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Measurement>();
+    SqlStatement(dm.Connection()).MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+        migration.AlterTable("Measurement").AddUniqueIndex("sensor");
+    });
+
+    auto loader = SqlBulkLoader<Measurement> { dm.Connection(), { .batchSize = 10 } };
+    loader.AddAll(std::vector<Measurement>(2)); // Both with the same sensor, violating its unique index.
+    CHECK_THROWS_AS(loader.Flush(), SqlException);
+    CHECK(loader.RowsLoaded() == 0);
+
+    // The failed batch is not sent again.
+    CHECK_NOTHROW(loader.Flush());
+    CHECK(loader.RowsLoaded() == 0);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "ParallelScan", "[DataMapper]")
+{
+    // In-memory SQLite databases are private to their connection, so let all connections share a database file.
+    auto connectionString = SqlConnection::DefaultConnectionString();
+    auto const databaseFile = std::filesystem::temp_directory_path() / "LightweightParallelScan.sqlite";
+    auto const inMemory = "file::memory:"sv;
+    if (auto const pos = connectionString.value.find(inMemory); pos != std::string::npos)
+    {
+        std::filesystem::remove(databaseFile);
+        connectionString.value.replace(pos, inMemory.size(), databaseFile.string());
+    }
+
+    {
+        auto dm = DataMapper { SqlConnection { connectionString } };
+        dm.CreateTable<Measurement>();
+
+        constexpr auto RecordCount = 1000;
+        auto loader = SqlBulkLoader<Measurement> { dm.Connection() };
+        for (auto const i: std::views::iota(0, RecordCount))
+        {
+            auto record = Measurement {};
+            record.sensor = i;
+            loader.Add(record);
+        }
+        loader.Finish();
+
+        auto pool = SqlConnectionPool {};
+        auto mutex = std::mutex {};
+        auto sensors = std::vector<int> {};
+        auto batchSizes = std::vector<size_t> {};
+        auto const count = ParallelScan<Measurement>(
+            pool,
+            "id",
+            [&](std::span<Measurement> batch) {
+                auto const lock = std::scoped_lock { mutex };
+                batchSizes.push_back(batch.size());
+                for (auto const& record: batch)
+                    sensors.push_back(record.sensor.Value());
+            },
+            { .partitionCount = 4, .batchSize = 100, .connectionString = connectionString });
+
+        CHECK(count == RecordCount);
+        CHECK(std::ranges::all_of(batchSizes, [](size_t size) { return size <= 100; }));
+        std::ranges::sort(sensors);
+        CHECK(sensors == std::ranges::to<std::vector>(std::views::iota(0, RecordCount)));
+    }
+
+    auto ec = std::error_code {};
+    std::filesystem::remove(databaseFile, ec);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "Stream", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+
+    for (auto const* name: { "Alice", "Bob", "Charlie", "Dave" })
+    {
+        auto person = Person {};
+        person.name = name;
+        person.is_active = std::string_view(name) != "Bob";
+        dm.Create(person);
+    }
+
+    static_assert(std::ranges::input_range<RecordStream<Person>>);
+    static_assert(std::ranges::view<RecordStream<Person>>);
+
+    // clang-format off
+    auto names = dm.Stream<Person>(dm.FromTable(RecordTableName<Person>)
+                                     .Select()
+                                     .Fields<Person>()
+                                     .OrderBy("name")
+                                     .All())
+               | std::views::filter([](Person const& person) { return person.is_active.Value(); })
+               | std::views::transform([](Person const& person) { return std::string(person.name.Value().str()); })
+               | std::views::take(2);
+    // clang-format on
+
+    auto const result = std::ranges::to<std::vector>(names);
+    CHECK(result == std::vector<std::string> { "Alice", "Charlie" });
+
+    auto const& selectAll = RecordStatementsOf<Person>(dm.Connection().ServerType()).selectAll;
+    auto count = size_t { 0 };
+    for ([[maybe_unused]] auto const& person: dm.Stream<Person>(selectAll))
+        ++count;
+    CHECK(count == 4);
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "partial row retrieval", "[DataMapper]")
 {
     auto dm = DataMapper();
@@ -287,6 +758,72 @@ TEST_CASE_METHOD(SqlTestFixture, "BelongsTo", "[DataMapper][relations]")
     }
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "Identity map", "[DataMapper][relations]")
+{
+    auto dm = DataMapper();
+    dm.CreateTables<User, Email>();
+    dm.EnableIdentityMap();
+
+    auto user = User { .name = "John Doe" };
+    dm.Create(user);
+
+    auto email1 = Email { .address = "john@doe.com", .user = user };
+    dm.Create(email1);
+
+    auto email2 = Email { .address = "john2@doe.com", .user = user };
+    dm.Create(email2);
+
+    auto emails = dm.All<Email>();
+    REQUIRE(emails.size() == 2);
+    CHECK(emails[0].user->name == user.name);
+    CHECK(emails[1].user->name == user.name);
+    CHECK(&emails[0].user.Record() == &emails[1].user.Record());
+    CHECK(dm.Identities().Size() == 1);
+
+    SECTION("Update invalidates")
+    {
+        auto email = dm.QuerySingle<Email>(email1.id.Value()).value();
+        CHECK(dm.Identities().Size() == 2);
+
+        email.address = "jane@doe.com";
+        dm.Update(email);
+        CHECK(dm.Identities().Size() == 1);
+
+        CHECK(dm.QuerySingle<Email>(email1.id.Value()).value().address.Value() == "jane@doe.com");
+    }
+
+    SECTION("Delete invalidates")
+    {
+        CHECK(dm.QuerySingle<Email>(email1.id.Value()).has_value());
+        CHECK(dm.Identities().Size() == 2);
+
+        dm.Delete(email1);
+        CHECK(dm.Identities().Size() == 1);
+        CHECK(!dm.QuerySingle<Email>(email1.id.Value()).has_value());
+    }
+
+    SECTION("Disabling clears")
+    {
+        dm.EnableIdentityMap(false);
+        CHECK(dm.Identities().Size() == 0);
+    }
+
+    SECTION("Copies share only identity-mapped records")
+    {
+        auto copy = emails[0];
+        CHECK(&copy.user.Record() == &emails[0].user.Record());
+
+        dm.EnableIdentityMap(false);
+        auto email = dm.QuerySingle<Email>(email1.id.Value()).value();
+        REQUIRE(email.user->name.Value() == user.name.Value());
+
+        auto emailCopy = email;
+        CHECK(&emailCopy.user.Record() != &email.user.Record());
+        emailCopy.user->name = "Jane Doe";
+        CHECK(email.user->name.Value() == user.name.Value());
+    }
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "HasMany", "[DataMapper][relations]")
 {
     auto dm = DataMapper();
@@ -332,6 +869,58 @@ TEST_CASE_METHOD(SqlTestFixture, "HasMany", "[DataMapper][relations]")
     }
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "Include", "[DataMapper][relations]")
+{
+    auto dm = DataMapper();
+    dm.CreateTables<User, Email>();
+
+    auto const johnDoeID = dm.CreateExplicit(User { .name = "John Doe" });
+    auto const janeDoeID = dm.CreateExplicit(User { .name = "Jane Doe" });
+    auto const jimDoeID = dm.CreateExplicit(User { .name = "Jim Doe" });
+    dm.CreateExplicit(Email { .address = "john@doe.com", .user = johnDoeID.value });
+    dm.CreateExplicit(Email { .address = "jane@doe.com", .user = janeDoeID.value });
+    dm.CreateExplicit(Email { .address = "john2@doe.com", .user = johnDoeID.value });
+
+    SECTION("HasMany")
+    {
+        auto users = dm.Query<User>(Include<&User::emails>(),
+                                    dm.FromTable(RecordTableName<User>).Select().Fields("id", "name").All());
+        REQUIRE(users.size() == 3);
+
+        auto const addressesOf = [](User& user) {
+            auto addresses = std::vector<std::string> {};
+            for (auto const& email: user.emails)
+                addresses.emplace_back(email->address.Value().str());
+            std::ranges::sort(addresses);
+            return addresses;
+        };
+
+        for (auto& user: users)
+        {
+            if (user.id.Value() == johnDoeID.value)
+                CHECK(addressesOf(user) == std::vector<std::string> { "john2@doe.com", "john@doe.com" });
+            else if (user.id.Value() == janeDoeID.value)
+                CHECK(addressesOf(user) == std::vector<std::string> { "jane@doe.com" });
+            else
+                CHECK(user.emails.IsEmpty());
+        }
+    }
+
+    SECTION("BelongsTo")
+    {
+        auto emails = dm.All<Email>(Include<&Email::user>());
+        REQUIRE(emails.size() == 3);
+
+        for (auto const& email: emails)
+        {
+            REQUIRE(email.user.IsLoaded());
+            CHECK(email.user->id.Value() == email.user.Value());
+            auto const expectedName = email.user.Value() == johnDoeID.value ? "John Doe"sv : "Jane Doe"sv;
+            CHECK(email.user->name.Value().str() == expectedName);
+        }
+    }
+}
+
 struct Suppliers;
 struct Account;
 struct AccountHistory;
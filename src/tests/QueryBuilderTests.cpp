@@ -399,6 +399,65 @@ TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.Insert", "[SqlQueryBuilder]")
         });
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.Insert multiple rows", "[SqlQueryBuilder]")
+{
+    std::vector<SqlVariant> boundValues;
+    checkSqlQueryBuilder(
+        [&](SqlQueryBuilder& q) {
+            return q.FromTable("Other")
+                .Insert(&boundValues)
+                .Set("foo", 42)
+                .Set("bar", SqlNullValue)
+                .NextRow()
+                .Set("foo", 43)
+                .Set("bar", "baz");
+        },
+        QueryExpectations {
+            .sqlite = R"(INSERT INTO "Other" ("foo", "bar") VALUES (?, NULL), (?, ?))",
+            .postgres = R"(INSERT INTO "Other" ("foo", "bar") VALUES (?, NULL), (?, ?))",
+            .sqlServer = R"(INSERT INTO "Other" ("foo", "bar") VALUES (?, NULL), (?, ?))",
+            .oracle = R"(INSERT INTO "Other" ("foo", "bar") SELECT ?, NULL FROM DUAL UNION ALL SELECT ?, ? FROM DUAL)",
+        },
+        [&]() {
+            CHECK(boundValues.size() == 3);
+            CHECK(std::get<int>(boundValues[0].value) == 42);
+            CHECK(std::get<int>(boundValues[1].value) == 43);
+            CHECK(std::get<std::string_view>(boundValues[2].value) == "baz");
+            boundValues.clear();
+        });
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.Upsert", "[SqlQueryBuilder]")
+{
+    std::vector<SqlVariant> boundValues;
+    checkSqlQueryBuilder(
+        [&](SqlQueryBuilder& q) {
+            return q.FromTable("Other").Upsert(&boundValues).Key("id", 123).Set("foo", 42).Set("bar", SqlNullValue);
+        },
+        QueryExpectations {
+            .sqlite = R"(INSERT INTO "Other" ("id", "foo", "bar") VALUES (?, ?, NULL))"
+                      R"( ON CONFLICT ("id") DO UPDATE SET "foo" = excluded."foo", "bar" = excluded."bar")",
+            .postgres = R"(INSERT INTO "Other" ("id", "foo", "bar") VALUES (?, ?, NULL))"
+                        R"( ON CONFLICT ("id") DO UPDATE SET "foo" = excluded."foo", "bar" = excluded."bar")",
+            .sqlServer =
+                R"(MERGE INTO "Other" WITH (HOLDLOCK) AS target USING (VALUES (?, ?, NULL)) AS source ("id", "foo", "bar"))"
+                R"( ON target."id" = source."id")"
+                R"( WHEN MATCHED THEN UPDATE SET "foo" = source."foo", "bar" = source."bar")"
+                R"( WHEN NOT MATCHED THEN INSERT ("id", "foo", "bar") VALUES (source."id", source."foo", source."bar");)",
+            .oracle = R"(MERGE INTO "Other" target USING (SELECT ? AS "id", ? AS "foo", NULL AS "bar" FROM DUAL) source)"
+                      R"( ON (target."id" = source."id"))"
+                      R"( WHEN MATCHED THEN UPDATE SET target."foo" = source."foo", target."bar" = source."bar")"
+                      R"( WHEN NOT MATCHED THEN INSERT ("id", "foo", "bar"))"
+                      R"( VALUES (source."id", source."foo", source."bar"))",
+        },
+        [&]() {
+            CHECK(boundValues.size() == 2);
+            CHECK(std::get<int>(boundValues[0].value) == 123);
+            CHECK(std::get<int>(boundValues[1].value) == 42);
+            boundValues.clear();
+        });
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.Update", "[SqlQueryBuilder]")
 {
     std::vector<SqlVariant> boundValues;